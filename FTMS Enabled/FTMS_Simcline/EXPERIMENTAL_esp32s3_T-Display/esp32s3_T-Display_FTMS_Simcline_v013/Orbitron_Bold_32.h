@@ -0,0 +1,199 @@
+// Created by http://oleddisplay.squix.ch/ Consider a donation
+// In case of problems make sure that you are using the font file with the correct version!
+const uint8_t Orbitron_Bold_32Bitmaps[] PROGMEM = {
+
+	// Bitmap Data:
+	0x00, // ' '
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x0F,0xFF,0xF0, // '!'
+	0xF7,0xFB,0xFD,0xFE,0xFF,0x7F,0xBC, // '"'
+	0x00,0xF8,0x3C,0x01,0xE0,0x78,0x03,0xC1,0xF0,0x0F,0x03,0xC0,0x1E,0x07,0x8F,0xFF,0xFF,0xDF,0xFF,0xFF,0xBF,0xFF,0xFF,0x7F,0xFF,0xFE,0x0F,0x83,0xC0,0x1E,0x07,0x80,0x3C,0x1F,0x00,0xF8,0x3C,0x01,0xE0,0x78,0x3F,0xFF,0xFF,0x7F,0xFF,0xFE,0xFF,0xFF,0xFD,0xFF,0xFF,0xF8,0xF8,0x3E,0x01,0xE0,0x78,0x03,0xC0,0xF0,0x07,0x83,0xE0,0x1F,0x07,0x80,0x00, // '#'
+	0x00,0x7C,0x00,0x00,0xF8,0x00,0x01,0xF0,0x01,0xFF,0xFF,0xC7,0xFF,0xFF,0xDF,0xFF,0xFF,0xBF,0xFF,0xFF,0xF8,0x3E,0x0F,0xF0,0x7C,0x1F,0xE0,0xF8,0x03,0xC1,0xF0,0x07,0x83,0xE0,0x0F,0xFF,0xFF,0x1F,0xFF,0xFF,0x1F,0xFF,0xFF,0x1F,0xFF,0xFF,0x0F,0xFF,0xFE,0x00,0xF8,0x3C,0x01,0xF0,0x78,0x03,0xE0,0xFF,0x07,0xC1,0xFE,0x0F,0x83,0xFF,0xFF,0xFF,0xBF,0xFF,0xFE,0x7F,0xFF,0xFC,0x7F,0xFF,0xF0,0x01,0xF0,0x00,0x03,0xE0,0x00,0x07,0xC0,0x00, // '$'
+	0x3F,0x00,0x01,0x8F,0xF8,0x00,0x73,0xFF,0x80,0x1E,0x7F,0xF0,0x07,0xCE,0x1E,0x03,0xF9,0xC3,0xC0,0xFE,0x38,0x78,0x3F,0x87,0x0F,0x0F,0xC0,0xFF,0xE3,0xF0,0x1F,0xF8,0xFC,0x01,0xFE,0x7F,0x00,0x00,0x1F,0xC0,0x00,0x07,0xF7,0xF8,0x01,0xF9,0xFF,0x80,0x7E,0x3F,0xF8,0x1F,0x8F,0x0F,0x0F,0xE1,0xE1,0xE3,0xF8,0x3C,0x3C,0xFC,0x07,0x87,0x9F,0x00,0xFF,0xF3,0xC0,0x0F,0xFC,0x70,0x01,0xFF,0x8C,0x00,0x0F,0xE0, // '%'
+	0x1F,0xFF,0xE0,0x0F,0xFF,0xFE,0x07,0xFF,0xFF,0x81,0xFF,0xFF,0xF0,0x78,0x00,0x7C,0x1E,0x00,0x1F,0x07,0x80,0x00,0x01,0xE0,0x00,0x00,0x78,0x00,0x00,0x1F,0x80,0x00,0x0F,0xF8,0x00,0x03,0xFF,0x80,0x00,0xF7,0xF8,0x3E,0x3C,0x7F,0x8F,0x8F,0x07,0xFB,0xE3,0xC0,0x7F,0xF8,0xF0,0x07,0xFE,0x3C,0x00,0x7F,0xCF,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFE,0x73,0xFF,0xFF,0x04, // '&'
+	0xFF,0xFF,0xFF, // '''
+	0x3D,0xFF,0xFF,0xF3,0xCF,0x3C,0xF3,0xCF,0x3C,0xF3,0xCF,0x3C,0xF3,0xCF,0x3F,0xFD,0xF3,0xC0, // '('
+	0xF3,0xEF,0xFF,0x3C,0xF3,0xCF,0x3C,0xF3,0xCF,0x3C,0xF3,0xCF,0x3C,0xF3,0xFF,0xFF,0xEF,0x00, // ')'
+	0x07,0x80,0x1E,0x00,0x78,0x19,0xE6,0x7F,0xFF,0xFF,0xFF,0xFF,0xCF,0xFC,0x1F,0xE0,0x7F,0xC3,0xFF,0x1F,0x3E,0x1C,0x60,0x21,0x00, // '*'
+	0x0F,0x00,0x78,0x03,0xC0,0x1E,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x78,0x03,0xC0,0x1E,0x00,0xF0,0x00, // '+'
+	0xFF,0xFF,0xFF,0xEC, // ','
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80, // '-'
+	0xFF,0xFF, // '.'
+	0x00,0x01,0x80,0x01,0xC0,0x01,0xE0,0x00,0xF0,0x00,0xF8,0x00,0xF8,0x00,0xF8,0x00,0xF8,0x00,0xF8,0x00,0x78,0x00,0x7C,0x00,0x7C,0x00,0x7C,0x00,0x7C,0x00,0x7C,0x00,0x3E,0x00,0x3E,0x00,0x3E,0x00,0x3E,0x00,0x1E,0x00,0x0E,0x00,0x07,0x00,0x03,0x00,0x00, // '/'
+	0x3F,0xFF,0xF0,0xFF,0xFF,0xFB,0xFF,0xFF,0xF7,0xFF,0xFF,0xFF,0x00,0x0F,0xFE,0x00,0x3F,0xFC,0x00,0xFF,0xF8,0x03,0xFF,0xF0,0x1F,0xFF,0xE0,0x7F,0x7F,0xC1,0xFC,0xFF,0x87,0xE1,0xFF,0x1F,0x83,0xFE,0x7E,0x07,0xFF,0xF8,0x0F,0xFF,0xE0,0x1F,0xFF,0x80,0x3F,0xFC,0x00,0x7F,0xF0,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCF,0xFF,0xFF,0x0F,0xFF,0xFC,0x00, // '0'
+	0x03,0xF0,0x3F,0x07,0xF0,0xFF,0x1F,0xF3,0xFF,0x7F,0xFF,0xDF,0x01,0xF0,0x1F,0x01,0xF0,0x1F,0x01,0xF0,0x1F,0x01,0xF0,0x1F,0x01,0xF0,0x1F,0x01,0xF0,0x1F,0x01,0xF0,0x1F,0x01,0xF0, // '1'
+	0x3F,0xFF,0xF0,0xFF,0xFF,0xFB,0xFF,0xFF,0xF7,0xFF,0xFF,0xFF,0x00,0x03,0xFE,0x00,0x07,0xC0,0x00,0x0F,0x80,0x00,0x1F,0x00,0x00,0x3E,0x00,0x00,0x7C,0xFF,0xFF,0xFB,0xFF,0xFF,0xEF,0xFF,0xFF,0x9F,0xFF,0xFE,0x3C,0x00,0x00,0x78,0x00,0x00,0xF0,0x00,0x01,0xE0,0x00,0x03,0xC0,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80, // '2'
+	0x3F,0xFF,0xE0,0xFF,0xFF,0xF3,0xFF,0xFF,0xE7,0xFF,0xFF,0xEF,0x00,0x07,0xDE,0x00,0x0F,0x80,0x00,0x1F,0x00,0x00,0x3E,0x00,0x00,0x7C,0x1F,0xFF,0xF8,0x3F,0xFF,0xE0,0x7F,0xFF,0xE0,0xFF,0xFF,0xC0,0x00,0x07,0xC0,0x00,0x0F,0x80,0x00,0x1F,0x00,0x00,0x3F,0xE0,0x00,0x7F,0xC0,0x00,0xFF,0xFF,0xFF,0xEF,0xFF,0xFF,0xCF,0xFF,0xFF,0x0F,0xFF,0xFC,0x00, // '3'
+	0x00,0x03,0xE0,0x00,0x1F,0x80,0x00,0xFE,0x00,0x07,0xF8,0x00,0x3F,0xE0,0x01,0xFF,0x80,0x0F,0xFE,0x00,0x7F,0x78,0x07,0xF1,0xE0,0x3F,0x87,0x81,0xFC,0x1E,0x0F,0xE0,0x78,0x7E,0x01,0xE3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0x00,0x07,0x80,0x00,0x1E,0x00,0x00,0x78,0x00,0x01,0xE0,0x00,0x07,0x80,0x00,0x1E,0x00, // '4'
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x1E,0x00,0x00,0x3C,0x00,0x00,0x78,0x00,0x00,0xF0,0x00,0x01,0xFF,0xFF,0xE3,0xFF,0xFF,0xE7,0xFF,0xFF,0xEF,0xFF,0xFF,0xE0,0x00,0x07,0xC0,0x00,0x0F,0x80,0x00,0x1F,0x00,0x00,0x3F,0xE0,0x00,0x7F,0xC0,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCF,0xFF,0xFF,0x8F,0xFF,0xFC,0x00, // '5'
+	0x3F,0xFF,0xE0,0xFF,0xFF,0xC3,0xFF,0xFF,0x87,0xFF,0xFF,0x0F,0x00,0x00,0x1E,0x00,0x00,0x3C,0x00,0x00,0x78,0x00,0x00,0xF0,0x00,0x01,0xFF,0xFF,0xE3,0xFF,0xFF,0xE7,0xFF,0xFF,0xEF,0xFF,0xFF,0xFE,0x00,0x07,0xFC,0x00,0x0F,0xF8,0x00,0x1F,0xF0,0x00,0x3F,0xE0,0x00,0x7F,0xC0,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCF,0xFF,0xFF,0x8F,0xFF,0xFC,0x00, // '6'
+	0xFF,0xFF,0x9F,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xF0,0x00,0x1E,0x00,0x03,0xC0,0x00,0x78,0x00,0x0F,0x00,0x01,0xE0,0x00,0x3C,0x00,0x07,0x80,0x00,0xF0,0x00,0x1E,0x00,0x03,0xC0,0x00,0x78,0x00,0x0F,0x00,0x01,0xE0,0x00,0x3C,0x00,0x07,0x80,0x00,0xF0,0x00,0x1E,0x00,0x03,0xC0,0x00,0x78, // '7'
+	0x3F,0xFF,0xF0,0xFF,0xFF,0xFB,0xFF,0xFF,0xF7,0xFF,0xFF,0xFF,0x00,0x03,0xFE,0x00,0x07,0xFC,0x00,0x0F,0xF8,0x00,0x1F,0xF0,0x00,0x3F,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0xEF,0xFF,0xFF,0xFE,0x00,0x07,0xFC,0x00,0x0F,0xF8,0x00,0x1F,0xF0,0x00,0x3F,0xE0,0x00,0x7F,0xC0,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCF,0xFF,0xFF,0x8F,0xFF,0xFC,0x00, // '8'
+	0x3F,0xFF,0xF1,0xFF,0xFF,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x00,0x3F,0xC0,0x00,0xFF,0x00,0x03,0xFC,0x00,0x0F,0xF0,0x00,0x3F,0xC0,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7F,0xFF,0xFC,0x7F,0xFF,0xF0,0x00,0x03,0xC0,0x00,0x0F,0x00,0x00,0x3C,0x00,0x00,0xF0,0x00,0x03,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xE3,0xFF,0xFF,0x00, // '9'
+	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,0xF0, // ':'
+	0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x0F,0xFF,0xFF,0xFE,0xC0, // ';'
+	0x00,0x0C,0x00,0x70,0x07,0xC0,0x7F,0x03,0xFC,0x3F,0xC3,0xFE,0x3F,0xE0,0xFE,0x03,0xE0,0x0F,0xE0,0x3F,0xE0,0x3F,0xC0,0x3F,0xC0,0x7F,0xC0,0x7F,0x00,0x7C,0x00,0x70,0x00,0xC0, // '<'
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0, // '='
+	0x80,0x07,0x00,0x3C,0x01,0xF8,0x0F,0xF0,0x3F,0xE0,0x7F,0x80,0xFF,0x03,0xF8,0x07,0xC0,0x7E,0x0F,0xF1,0xFF,0x3F,0xE3,0xFC,0x1F,0x80,0xF8,0x07,0x00,0x20,0x00, // '>'
+	0xFF,0xFF,0xCF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0xF0,0x00,0x0F,0x00,0x00,0xF0,0x00,0x0F,0x03,0xFF,0xF0,0x7F,0xFF,0x0F,0xFF,0xE1,0xFF,0xFC,0x1F,0x00,0x01,0xE0,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xE0,0x00,0x1E,0x00,0x01,0xE0,0x00,0x1E,0x00,0x00, // '?'
+	0x3F,0xFF,0xF0,0xFF,0xFF,0xFB,0xFF,0xFF,0xF7,0xFF,0xFF,0xFF,0x00,0x03,0xFE,0x00,0x07,0xFC,0x3F,0x0F,0xF8,0xFF,0x9F,0xF3,0xFF,0x3F,0xE7,0x0F,0x7F,0xCE,0x1E,0xFF,0x9C,0x3D,0xFF,0x38,0x7B,0xFE,0x7F,0xFF,0xFC,0xFF,0xFF,0xF8,0xFF,0xFF,0xF0,0x7F,0xFF,0xE0,0x00,0x03,0xC0,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xFF,0xFF,0xCF,0xFF,0xFF,0x80, // '@'
+	0x3F,0xFF,0xF8,0xFF,0xFF,0xFB,0xFF,0xFF,0xF7,0xFF,0xFF,0xFF,0x00,0x01,0xFE,0x00,0x03,0xFC,0x00,0x07,0xF8,0x00,0x0F,0xF0,0x00,0x1F,0xE0,0x00,0x3F,0xC0,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x00,0x0F,0xF0,0x00,0x1F,0xE0,0x00,0x3F,0xC0,0x00,0x7F,0x80,0x00,0xFF,0x00,0x01,0xFE,0x00,0x03,0xFC,0x00,0x07,0x80, // 'A'
+	0xFF,0xFF,0xF1,0xFF,0xFF,0xF3,0xFF,0xFF,0xF7,0xFF,0xFF,0xEF,0x00,0x03,0xDE,0x00,0x07,0xBC,0x00,0x0F,0x78,0x00,0x1E,0xF0,0x00,0x3D,0xFF,0xFF,0xFB,0xFF,0xFF,0xF7,0xFF,0xFF,0xEF,0xFF,0xFF,0xFE,0x00,0x03,0xFC,0x00,0x07,0xF8,0x00,0x0F,0xF0,0x00,0x1F,0xE0,0x00,0x3F,0xC0,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xBF,0xFF,0xFC,0x00, // 'B'
+	0x3F,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x1E,0x00,0x00,0x3C,0x00,0x00,0x78,0x00,0x00,0xF0,0x00,0x01,0xE0,0x00,0x03,0xC0,0x00,0x07,0x80,0x00,0x0F,0x00,0x00,0x1E,0x00,0x00,0x3C,0x00,0x00,0x78,0x00,0x00,0xF0,0x00,0x01,0xE0,0x00,0x03,0xC0,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xFF,0xFF,0xCF,0xFF,0xFF,0x80, // 'C'
+	0xFF,0xFF,0xF9,0xFF,0xFF,0xFB,0xFF,0xFF,0xF7,0xFF,0xFF,0xFF,0x00,0x01,0xFE,0x00,0x03,0xFC,0x00,0x07,0xF8,0x00,0x0F,0xF0,0x00,0x1F,0xE0,0x00,0x3F,0xC0,0x00,0x7F,0x80,0x00,0xFF,0x00,0x01,0xFE,0x00,0x03,0xFC,0x00,0x07,0xF8,0x00,0x0F,0xF0,0x00,0x1F,0xE0,0x00,0x3F,0xC0,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xBF,0xFF,0xFC,0x00, // 'D'
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x78,0x00,0x03,0xC0,0x00,0x1E,0x00,0x00,0xF0,0x00,0x07,0xFF,0xFE,0x3F,0xFF,0xF1,0xFF,0xFF,0x8F,0xFF,0xFC,0x7F,0xFF,0xE3,0xC0,0x00,0x1E,0x00,0x00,0xF0,0x00,0x07,0x80,0x00,0x3C,0x00,0x01,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0, // 'E'
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x78,0x00,0x03,0xC0,0x00,0x1E,0x00,0x00,0xF0,0x00,0x07,0xFF,0xFE,0x3F,0xFF,0xF1,0xFF,0xFF,0x8F,0xFF,0xFC,0x7F,0xFF,0xE3,0xC0,0x00,0x1E,0x00,0x00,0xF0,0x00,0x07,0x80,0x00,0x3C,0x00,0x01,0xE0,0x00,0x0F,0x00,0x00,0x78,0x00,0x03,0xC0,0x00,0x00, // 'F'
+	0x3F,0xFF,0xF8,0xFF,0xFF,0xFB,0xFF,0xFF,0xF7,0xFF,0xFF,0xFF,0x00,0x01,0xFE,0x00,0x03,0xFC,0x00,0x00,0x78,0x00,0x00,0xF0,0x00,0x01,0xE0,0x00,0x03,0xC0,0x1F,0xFF,0x80,0x3F,0xFF,0x00,0x7F,0xFE,0x00,0xFF,0xFC,0x00,0x07,0xF8,0x00,0x0F,0xF0,0x00,0x1F,0xE0,0x00,0x3F,0xC0,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xCF,0xFF,0xFF,0x8F,0xFF,0xFC,0x00, // 'G'
+	0xF0,0x00,0x1F,0xE0,0x00,0x3F,0xC0,0x00,0x7F,0x80,0x00,0xFF,0x00,0x01,0xFE,0x00,0x03,0xFC,0x00,0x07,0xF8,0x00,0x0F,0xF0,0x00,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0x00,0x07,0xF8,0x00,0x0F,0xF0,0x00,0x1F,0xE0,0x00,0x3F,0xC0,0x00,0x7F,0x80,0x00,0xFF,0x00,0x01,0xFE,0x00,0x03,0xFC,0x00,0x07,0x80, // 'H'
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0, // 'I'
+	0x00,0x00,0x1E,0x00,0x00,0x3C,0x00,0x00,0x78,0x00,0x00,0xF0,0x00,0x01,0xE0,0x00,0x03,0xC0,0x00,0x07,0x80,0x00,0x0F,0x00,0x00,0x1E,0x00,0x00,0x3C,0x00,0x00,0x78,0x00,0x00,0xF0,0x00,0x01,0xE0,0x00,0x03,0xC0,0x00,0x07,0x80,0x00,0x0F,0xF0,0x00,0x1F,0xE0,0x00,0x3F,0xC0,0x00,0x7F,0xFF,0xFF,0xF7,0xFF,0xFF,0xEF,0xFF,0xFF,0x87,0xFF,0xFE,0x00, // 'J'
+	0xF0,0x00,0x7F,0xC0,0x03,0xFF,0x00,0x1F,0xBC,0x00,0xFC,0xF0,0x03,0xE3,0xC0,0x1F,0x0F,0x00,0xFC,0x3C,0x07,0xE0,0xF0,0x3F,0x03,0xFF,0xF8,0x0F,0xFF,0xC0,0x3F,0xFE,0x00,0xFF,0xFC,0x03,0xFF,0xF8,0x0F,0x03,0xF0,0x3C,0x07,0xE0,0xF0,0x0F,0xC3,0xC0,0x1F,0x0F,0x00,0x3E,0x3C,0x00,0xFC,0xF0,0x01,0xFB,0xC0,0x03,0xFF,0x00,0x07,0xC0, // 'K'
+	0xF0,0x00,0x01,0xE0,0x00,0x03,0xC0,0x00,0x07,0x80,0x00,0x0F,0x00,0x00,0x1E,0x00,0x00,0x3C,0x00,0x00,0x78,0x00,0x00,0xF0,0x00,0x01,0xE0,0x00,0x03,0xC0,0x00,0x07,0x80,0x00,0x0F,0x00,0x00,0x1E,0x00,0x00,0x3C,0x00,0x00,0x78,0x00,0x00,0xF0,0x00,0x01,0xE0,0x00,0x03,0xC0,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80, // 'L'
+	0xF8,0x00,0x07,0xFF,0x00,0x03,0xFF,0xE0,0x01,0xFF,0xF8,0x00,0xFF,0xFF,0x00,0x7F,0xFF,0xE0,0x3F,0xFF,0xFC,0x0F,0xBF,0xDF,0x87,0xCF,0xF3,0xF3,0xF3,0xFC,0x7D,0xF8,0xFF,0x0F,0xFC,0x3F,0xC1,0xFE,0x0F,0xF0,0x7F,0x03,0xFC,0x0F,0x80,0xFF,0x01,0xC0,0x3F,0xC0,0x30,0x0F,0xF0,0x08,0x03,0xFC,0x00,0x00,0xFF,0x00,0x00,0x3F,0xC0,0x00,0x0F,0xF0,0x00,0x03,0xFC,0x00,0x00,0xFF,0x00,0x00,0x3C, // 'M'
+	0xF8,0x00,0x1F,0xF8,0x00,0x3F,0xF8,0x00,0x7F,0xF0,0x00,0xFF,0xF0,0x01,0xFF,0xF0,0x03,0xFF,0xF0,0x07,0xFB,0xF0,0x0F,0xF3,0xF0,0x1F,0xE3,0xE0,0x3F,0xC3,0xE0,0x7F,0x83,0xE0,0xFF,0x07,0xE1,0xFE,0x07,0xE3,0xFC,0x07,0xE7,0xF8,0x07,0xCF,0xF0,0x07,0xDF,0xE0,0x07,0xFF,0xC0,0x0F,0xFF,0x80,0x0F,0xFF,0x00,0x0F,0xFE,0x00,0x0F,0xFC,0x00,0x0F,0x80, // 'N'
+	0x3F,0xFF,0xF0,0xFF,0xFF,0xFB,0xFF,0xFF,0xF7,0xFF,0xFF,0xFF,0x00,0x01,0xFE,0x00,0x03,0xFC,0x00,0x07,0xF8,0x00,0x0F,0xF0,0x00,0x1F,0xE0,0x00,0x3F,0xC0,0x00,0x7F,0x80,0x00,0xFF,0x00,0x01,0xFE,0x00,0x03,0xFC,0x00,0x07,0xF8,0x00,0x0F,0xF0,0x00,0x1F,0xE0,0x00,0x3F,0xC0,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xCF,0xFF,0xFF,0x8F,0xFF,0xFC,0x00, // 'O'
+	0xFF,0xFF,0xF1,0xFF,0xFF,0xFB,0xFF,0xFF,0xF7,0xFF,0xFF,0xFF,0x00,0x01,0xFE,0x00,0x03,0xFC,0x00,0x07,0xF8,0x00,0x0F,0xF0,0x00,0x1F,0xE0,0x00,0x3F,0xC0,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xBF,0xFF,0xFE,0x78,0x00,0x00,0xF0,0x00,0x01,0xE0,0x00,0x03,0xC0,0x00,0x07,0x80,0x00,0x0F,0x00,0x00,0x1E,0x00,0x00,0x3C,0x00,0x00,0x00, // 'P'
+	0x3F,0xFF,0xF0,0x1F,0xFF,0xFF,0x0F,0xFF,0xFF,0xC3,0xFF,0xFF,0xF8,0xF0,0x00,0x1E,0x3C,0x00,0x07,0x8F,0x00,0x01,0xE3,0xC0,0x00,0x78,0xF0,0x00,0x1E,0x3C,0x00,0x07,0x8F,0x00,0x01,0xE3,0xC0,0x00,0x78,0xF0,0x00,0x1E,0x3C,0x00,0x07,0x8F,0x00,0x01,0xE3,0xC0,0x00,0x78,0xF0,0x00,0x1E,0x3C,0x00,0x07,0x8F,0x00,0x01,0xE3,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xF3,0xFF,0xFF,0xFC, // 'Q'
+	0xFF,0xFF,0xF1,0xFF,0xFF,0xFB,0xFF,0xFF,0xF7,0xFF,0xFF,0xFF,0x00,0x01,0xFE,0x00,0x03,0xFC,0x00,0x07,0xF8,0x00,0x0F,0xF0,0x00,0x1F,0xE0,0x00,0x3F,0xC0,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xBF,0xFF,0xFE,0x78,0x07,0xC0,0xF0,0x07,0xC1,0xE0,0x07,0xC3,0xC0,0x0F,0xC7,0x80,0x0F,0xCF,0x00,0x0F,0xDE,0x00,0x0F,0xBC,0x00,0x0F,0x80, // 'R'
+	0x3F,0xFF,0xF0,0xFF,0xFF,0xFB,0xFF,0xFF,0xF7,0xFF,0xFF,0xFF,0x00,0x03,0xFE,0x00,0x07,0xFC,0x00,0x00,0x78,0x00,0x00,0xF0,0x00,0x01,0xFF,0xFF,0xC3,0xFF,0xFF,0xE7,0xFF,0xFF,0xE7,0xFF,0xFF,0xC1,0xFF,0xFF,0xC0,0x00,0x0F,0x80,0x00,0x1F,0x00,0x00,0x3F,0xE0,0x00,0x7F,0xC0,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xCF,0xFF,0xFF,0x8F,0xFF,0xFC,0x00, // 'S'
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x07,0x80,0x00,0x0F,0x00,0x00,0x1E,0x00,0x00,0x3C,0x00,0x00,0x78,0x00,0x00,0xF0,0x00,0x01,0xE0,0x00,0x03,0xC0,0x00,0x07,0x80,0x00,0x0F,0x00,0x00,0x1E,0x00,0x00,0x3C,0x00,0x00,0x78,0x00,0x00,0xF0,0x00,0x01,0xE0,0x00,0x03,0xC0,0x00,0x07,0x80,0x00,0x0F,0x00,0x00,0x1E,0x00,0x00, // 'T'
+	0xF0,0x00,0x1F,0xE0,0x00,0x3F,0xC0,0x00,0x7F,0x80,0x00,0xFF,0x00,0x01,0xFE,0x00,0x03,0xFC,0x00,0x07,0xF8,0x00,0x0F,0xF0,0x00,0x1F,0xE0,0x00,0x3F,0xC0,0x00,0x7F,0x80,0x00,0xFF,0x00,0x01,0xFE,0x00,0x03,0xFC,0x00,0x07,0xF8,0x00,0x0F,0xF0,0x00,0x1F,0xE0,0x00,0x3F,0xC0,0x00,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xCF,0xFF,0xFF,0x8F,0xFF,0xFC,0x00, // 'U'
+	0xF8,0x00,0x00,0x7E,0xF8,0x00,0x00,0xF8,0xF0,0x00,0x03,0xE1,0xF0,0x00,0x07,0xC1,0xF0,0x00,0x1F,0x03,0xE0,0x00,0x7C,0x03,0xE0,0x00,0xF8,0x07,0xC0,0x03,0xE0,0x07,0xC0,0x07,0xC0,0x07,0xC0,0x1F,0x00,0x0F,0x80,0x3C,0x00,0x0F,0x80,0xF8,0x00,0x1F,0x03,0xE0,0x00,0x1F,0x07,0xC0,0x00,0x1E,0x1F,0x00,0x00,0x3E,0x3E,0x00,0x00,0x3E,0xF8,0x00,0x00,0x7D,0xE0,0x00,0x00,0x7F,0xC0,0x00,0x00,0xFF,0x00,0x00,0x00,0xFE,0x00,0x00,0x00,0xF8,0x00,0x00,0x01,0xF0,0x00,0x00, // 'V'
+	0xF8,0x00,0xF0,0x01,0xEF,0x00,0x3E,0x00,0x7D,0xF0,0x07,0xE0,0x0F,0xBE,0x01,0xFC,0x01,0xE3,0xC0,0x3F,0xC0,0x7C,0x7C,0x07,0xF8,0x0F,0x0F,0x81,0xFF,0x01,0xE0,0xF0,0x3D,0xF0,0x7C,0x1F,0x07,0xBE,0x0F,0x01,0xE1,0xF3,0xC3,0xE0,0x3C,0x3C,0x7C,0x7C,0x07,0xCF,0x87,0x8F,0x00,0x79,0xF0,0xF3,0xE0,0x0F,0xBC,0x1F,0x7C,0x01,0xFF,0x81,0xEF,0x00,0x1F,0xF0,0x3F,0xE0,0x03,0xFC,0x07,0xF8,0x00,0x7F,0x80,0x7F,0x00,0x07,0xE0,0x0F,0xE0,0x00,0xFC,0x01,0xF8,0x00,0x0F,0x80,0x1F,0x00,0x01,0xE0,0x03,0xE0,0x00,0x3C,0x00,0x38,0x00, // 'W'
+	0xFC,0x00,0x3F,0x7C,0x00,0x3E,0x3E,0x00,0x7C,0x3F,0x00,0xF8,0x1F,0x81,0xF8,0x0F,0xC3,0xF0,0x07,0xE7,0xE0,0x03,0xE7,0xC0,0x01,0xFF,0x80,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0x7E,0x00,0x00,0xFF,0x00,0x01,0xFF,0x00,0x01,0xFF,0x80,0x03,0xE7,0xC0,0x07,0xE7,0xE0,0x0F,0xC3,0xF0,0x1F,0x81,0xF8,0x3F,0x00,0xFC,0x3E,0x00,0x7C,0x7C,0x00,0x3E,0xFC,0x00,0x3F, // 'X'
+	0xF8,0x00,0x0F,0xBE,0x00,0x0F,0x9F,0x80,0x0F,0x87,0xC0,0x0F,0x81,0xF0,0x0F,0xC0,0x7C,0x07,0xC0,0x3F,0x07,0xC0,0x0F,0xC7,0xE0,0x03,0xE7,0xE0,0x00,0xFB,0xE0,0x00,0x7F,0xE0,0x00,0x1F,0xF0,0x00,0x07,0xF0,0x00,0x01,0xF0,0x00,0x00,0xF0,0x00,0x00,0x78,0x00,0x00,0x3C,0x00,0x00,0x1E,0x00,0x00,0x0F,0x00,0x00,0x07,0x80,0x00,0x03,0xC0,0x00,0x01,0xE0,0x00,0x00,0xF0,0x00, // 'Y'
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x00,0x0F,0xE0,0x00,0x3F,0x80,0x00,0xFC,0x00,0x03,0xF0,0x00,0x1F,0xC0,0x00,0x7F,0x00,0x01,0xFC,0x00,0x07,0xE0,0x00,0x1F,0x80,0x00,0xFE,0x00,0x03,0xF8,0x00,0x0F,0xE0,0x00,0x3F,0x80,0x00,0xFC,0x00,0x03,0xF0,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80, // 'Z'
+	0xFF,0xFF,0xFF,0xF3,0xCF,0x3C,0xF3,0xCF,0x3C,0xF3,0xCF,0x3C,0xF3,0xCF,0x3F,0xFF,0xFF,0xC0, // '['
+	0xC0,0x00,0x70,0x00,0x38,0x00,0x1E,0x00,0x0F,0x80,0x03,0xE0,0x00,0xF8,0x00,0x3E,0x00,0x1F,0x00,0x07,0xC0,0x01,0xF0,0x00,0x7C,0x00,0x1F,0x00,0x07,0x80,0x03,0xE0,0x00,0xF8,0x00,0x3E,0x00,0x0F,0x80,0x03,0xE0,0x00,0xF0,0x00,0x78,0x00,0x1C,0x00,0x06, // '\'
+	0xFF,0xFF,0xFF,0x3C,0xF3,0xCF,0x3C,0xF3,0xCF,0x3C,0xF3,0xCF,0x3C,0xF3,0xFF,0xFF,0xFF,0xC0, // ']'
+	0x00, // '^'
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0, // '_'
+	0xF3,0xE7,0x9E,0x79,0xF0, // '`'
+	0xFF,0xFC,0x1F,0xFF,0xF3,0xFF,0xFF,0x7F,0xFF,0xEF,0xFF,0xFC,0x00,0x07,0xC0,0x00,0xF8,0x00,0x1F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x3F,0xE0,0x07,0xFC,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xFF,0xFC,0xFF,0xFF,0x80, // 'a'
+	0xF0,0x00,0x1E,0x00,0x03,0xC0,0x00,0x78,0x00,0x0F,0x00,0x01,0xE0,0x00,0x3F,0xFF,0x07,0xFF,0xFC,0xFF,0xFF,0xDF,0xFF,0xFB,0xFF,0xFF,0xF8,0x01,0xFF,0x00,0x3F,0xE0,0x07,0xFC,0x00,0xFF,0x80,0x1F,0xF0,0x03,0xFE,0x00,0x7F,0xC0,0x0F,0xF8,0x01,0xFF,0x00,0x3F,0xFF,0xFF,0xBF,0xFF,0xF7,0xFF,0xFC,0xFF,0xFF,0x00, // 'b'
+	0x0F,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0x00,0x0F,0x00,0x03,0xC0,0x00,0xF0,0x00,0x3C,0x00,0x0F,0x00,0x03,0xC0,0x00,0xF0,0x00,0x3C,0x00,0x0F,0x00,0x03,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xF3,0xFF,0xFC, // 'c'
+	0x00,0x03,0xE0,0x00,0x7C,0x00,0x0F,0x80,0x01,0xF0,0x00,0x3E,0x00,0x07,0xC7,0xFF,0xFB,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x01,0xFF,0x00,0x3F,0xE0,0x07,0xFC,0x00,0xFF,0x80,0x1F,0xF0,0x03,0xFE,0x00,0x7F,0xC0,0x0F,0xF8,0x01,0xFF,0x00,0x3F,0xFF,0xFF,0xFF,0xFF,0xFB,0xFF,0xFF,0x3F,0xFF,0xE0, // 'd'
+	0x0F,0xFC,0x1F,0xFF,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0x00,0xFF,0x00,0x3F,0xC0,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0,0x00,0x3C,0x00,0x0F,0x00,0x03,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xF3,0xFF,0xFC, // 'e'
+	0x1F,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x3F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x0F,0x01,0xE0,0x3C,0x07,0x80,0xF0,0x1E,0x03,0xC0,0x78,0x0F,0x01,0xE0,0x3C,0x07,0x80,0xF0,0x00, // 'f'
+	0x0F,0xFF,0x07,0xFF,0xF9,0xFF,0xFF,0x7F,0xFF,0xFF,0xFF,0xFF,0xF0,0x03,0xFE,0x00,0x7F,0xC0,0x0F,0xF8,0x01,0xFF,0x00,0x3F,0xE0,0x07,0xFC,0x00,0xFF,0x80,0x1F,0xF0,0x03,0xFE,0x00,0x7F,0xFF,0xFF,0x7F,0xFF,0xEF,0xFF,0xFC,0x7F,0xFF,0x80,0x00,0xF0,0x00,0x1E,0x00,0x03,0xC7,0xFF,0xF8,0xFF,0xFF,0x1F,0xFF,0xC3,0xFF,0xF0, // 'g'
+	0xF0,0x00,0x1E,0x00,0x03,0xC0,0x00,0x78,0x00,0x0F,0x00,0x01,0xE0,0x00,0x3F,0xFF,0x07,0xFF,0xFC,0xFF,0xFF,0xDF,0xFF,0xFB,0xFF,0xFF,0xF8,0x01,0xFF,0x00,0x3F,0xE0,0x07,0xFC,0x00,0xFF,0x80,0x1F,0xF0,0x03,0xFE,0x00,0x7F,0xC0,0x0F,0xF8,0x01,0xFF,0x00,0x3F,0xE0,0x07,0xFC,0x00,0xFF,0x80,0x1F,0xF0,0x03,0xE0, // 'h'
+	0xFF,0xFF,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0, // 'i'
+	0x00,0xF0,0x0F,0x00,0xF0,0x0F,0x00,0xF0,0x00,0x00,0xF0,0x0F,0x00,0xF0,0x0F,0x00,0xF0,0x0F,0x00,0xF0,0x0F,0x00,0xF0,0x0F,0x00,0xF0,0x0F,0x00,0xF0,0x0F,0x00,0xF0,0x0F,0x00,0xF0,0x0F,0x00,0xF0,0x0F,0x00,0xF0,0x0F,0xFF,0xFF,0xFF,0xFF,0xEF,0xFC, // 'j'
+	0xF0,0x00,0x3C,0x00,0x0F,0x00,0x03,0xC0,0x00,0xF0,0x00,0x3C,0x00,0x0F,0x00,0x3F,0xC0,0x1F,0xF0,0x0F,0xBC,0x07,0xEF,0x03,0xF3,0xC1,0xF8,0xF0,0xFC,0x3C,0x7E,0x0F,0xFF,0x03,0xFF,0x80,0xFF,0xF0,0x3F,0xFE,0x0F,0x0F,0x83,0xC1,0xF0,0xF0,0x3E,0x3C,0x07,0xCF,0x00,0xFB,0xC0,0x3F,0xF0,0x07,0xC0, // 'k'
+	0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xFF,0xFF,0x7F,0x3F, // 'l'
+	0xFF,0xFF,0xFE,0x1F,0xFF,0xFF,0xFB,0xFF,0xFF,0xFF,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x3E,0x03,0xFC,0x07,0xC0,0x7F,0x80,0xF8,0x0F,0xF0,0x1F,0x01,0xFE,0x03,0xE0,0x3F,0xC0,0x7C,0x07,0xF8,0x0F,0x80,0xFF,0x01,0xF0,0x1F,0xE0,0x3E,0x03,0xFC,0x07,0xC0,0x7F,0x80,0xF8,0x0F,0xF0,0x1F,0x01,0xFE,0x03,0xE0,0x3F,0xC0,0x7C,0x07,0x80, // 'm'
+	0xFF,0xFC,0x1F,0xFF,0xF3,0xFF,0xFF,0x7F,0xFF,0xEF,0xFF,0xFF,0xE0,0x07,0xFC,0x00,0xFF,0x80,0x1F,0xF0,0x03,0xFE,0x00,0x7F,0xC0,0x0F,0xF8,0x01,0xFF,0x00,0x3F,0xE0,0x07,0xFC,0x00,0xFF,0x80,0x1F,0xF0,0x03,0xFE,0x00,0x7F,0xC0,0x0F,0x80, // 'n'
+	0x0F,0xFC,0x1F,0xFF,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0x00,0xFF,0x00,0x3F,0xC0,0x0F,0xF0,0x03,0xFC,0x00,0xFF,0x00,0x3F,0xC0,0x0F,0xF0,0x03,0xFC,0x00,0xFF,0x00,0x3F,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xE3,0xFF,0xF0, // 'o'
+	0xFF,0xFC,0x1F,0xFF,0xF3,0xFF,0xFF,0x7F,0xFF,0xEF,0xFF,0xFF,0xE0,0x07,0xFC,0x00,0xFF,0x80,0x1F,0xF0,0x03,0xFE,0x00,0x7F,0xC0,0x0F,0xF8,0x01,0xFF,0x00,0x3F,0xE0,0x07,0xFC,0x00,0xFF,0xFF,0xFE,0xFF,0xFF,0xDF,0xFF,0xF3,0xFF,0xFC,0x78,0x00,0x0F,0x00,0x01,0xE0,0x00,0x3C,0x00,0x07,0x80,0x00,0xF0,0x00,0x1E,0x00,0x00, // 'p'
+	0x0F,0xFF,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0x07,0xFC,0x00,0xFF,0x80,0x1F,0xF0,0x03,0xFE,0x00,0x7F,0xC0,0x0F,0xF8,0x01,0xFF,0x00,0x3F,0xE0,0x07,0xFC,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xEF,0xFF,0xFC,0xFF,0xFF,0x80,0x01,0xF0,0x00,0x3E,0x00,0x07,0xC0,0x00,0xF8,0x00,0x1F,0x00,0x03,0xE0,0x00,0x7C, // 'q'
+	0x1F,0xFD,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xC0,0x0F,0x00,0x3C,0x00,0xF0,0x03,0xC0,0x0F,0x00,0x3C,0x00,0xF0,0x03,0xC0,0x0F,0x00,0x3C,0x00,0xF0,0x03,0xC0,0x0F,0x00,0x00, // 'r'
+	0x0F,0xFC,0x1F,0xFF,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFC,0x00,0xFF,0x00,0x03,0xC0,0x00,0xFF,0xFF,0xBF,0xFF,0xF7,0xFF,0xFC,0xFF,0xFF,0x00,0x03,0xC0,0x00,0xFF,0x00,0x3F,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xE3,0xFF,0xF0, // 's'
+	0xF0,0x1E,0x03,0xC0,0x78,0x0F,0x01,0xE0,0x3F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF8,0x0F,0x01,0xE0,0x3C,0x07,0x80,0xF0,0x1E,0x03,0xC0,0x78,0x0F,0x01,0xFF,0xFF,0xFB,0xFF,0x3F,0xE0, // 't'
+	0xF0,0x03,0xFE,0x00,0x7F,0xC0,0x0F,0xF8,0x01,0xFF,0x00,0x3F,0xE0,0x07,0xFC,0x00,0xFF,0x80,0x1F,0xF0,0x03,0xFE,0x00,0x7F,0xC0,0x0F,0xF8,0x01,0xFF,0x00,0x3F,0xE0,0x07,0xFC,0x00,0xFF,0xFF,0xFE,0xFF,0xFF,0xCF,0xFF,0xF0,0xFF,0xFC,0x00, // 'u'
+	0xF8,0x00,0x1F,0xF8,0x00,0x1E,0x7C,0x00,0x3E,0x7C,0x00,0x7C,0x3E,0x00,0x7C,0x3E,0x00,0xF8,0x1F,0x00,0xF8,0x0F,0x01,0xF0,0x0F,0x81,0xF0,0x07,0x83,0xE0,0x07,0xC3,0xC0,0x03,0xE7,0xC0,0x03,0xE7,0x80,0x01,0xFF,0x80,0x01,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFE,0x00,0x00,0x7E,0x00,0x00,0x3C,0x00, // 'v'
+	0xF8,0x03,0xC0,0x1F,0x78,0x07,0xE0,0x1E,0x78,0x07,0xE0,0x1E,0x7C,0x0F,0xF0,0x3E,0x3C,0x0F,0xF0,0x3C,0x3E,0x0F,0xF0,0x7C,0x1E,0x1F,0xF8,0x7C,0x1E,0x1F,0xF8,0x78,0x1F,0x3E,0x7C,0xF8,0x0F,0x3E,0x7C,0xF0,0x0F,0xFC,0x3E,0xF0,0x0F,0xFC,0x3F,0xF0,0x07,0xF8,0x1F,0xE0,0x07,0xF8,0x1F,0xE0,0x03,0xF8,0x0F,0xE0,0x03,0xF0,0x0F,0xC0,0x03,0xF0,0x0F,0xC0,0x01,0xE0,0x07,0x80,0x01,0xE0,0x07,0x80, // 'w'
+	0xF8,0x01,0xFF,0xC0,0x3F,0x7E,0x07,0xE3,0xF0,0xFC,0x1F,0x8F,0x80,0xF9,0xF0,0x07,0xFE,0x00,0x3F,0xE0,0x03,0xFC,0x00,0x1F,0x80,0x01,0xFC,0x00,0x3F,0xC0,0x07,0xFE,0x00,0xFD,0xF0,0x1F,0x9F,0x83,0xF0,0xFC,0x3E,0x07,0xC7,0xC0,0x3E,0xF8,0x01,0xF0, // 'x'
+	0xF8,0x01,0xFF,0x00,0x3F,0xE0,0x07,0xFC,0x00,0xFF,0x80,0x1F,0xF0,0x03,0xFE,0x00,0x7F,0xC0,0x0F,0xF8,0x01,0xFF,0x00,0x3F,0xE0,0x07,0xFC,0x00,0xFF,0x80,0x1F,0xF0,0x03,0xFE,0x00,0x7F,0xFF,0xFF,0x7F,0xFF,0xEF,0xFF,0xFC,0x7F,0xFF,0x80,0x00,0xF0,0x00,0x1E,0x00,0x03,0xC7,0xFF,0xF8,0xFF,0xFF,0x1F,0xFF,0xC3,0xFF,0xF0, // 'y'
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0x00,0x3F,0x80,0x0F,0xE0,0x03,0xF0,0x01,0xFC,0x00,0x7F,0x00,0x1F,0xC0,0x0F,0xE0,0x03,0xF8,0x00,0xFE,0x00,0x3F,0x00,0x07,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x80, // 'z'
+	0x1E,0x7D,0xFB,0xF7,0x8F,0x1E,0x3C,0x79,0xF3,0xC7,0x8F,0x9F,0x1E,0x3C,0x78,0xF1,0xE3,0xF7,0xE7,0xC7,0x80, // '{'
+	0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF0, // '|'
+	0xF1,0xF3,0xE7,0xE3,0xC7,0x8F,0x1E,0x3C,0x7C,0xF8,0xF3,0xE7,0xCF,0x1E,0x3C,0x78,0xF7,0xEF,0x9F,0x38,0x00 // '}'
+};
+const GFXglyph Orbitron_Bold_32Glyphs[] PROGMEM = {
+// bitmapOffset, width, height, xAdvance, xOffset, yOffset
+	  {     0,   1,   1,  11,    0,   -1 }, // ' '
+	  {     1,   4,  23,   8,    2,  -23 }, // '!'
+	  {    13,   9,   6,  13,    2,  -23 }, // '"'
+	  {    20,  23,  23,  27,    1,  -23 }, // '#'
+	  {    87,  23,  29,  26,    1,  -26 }, // '$'
+	  {   171,  27,  23,  32,    2,  -23 }, // '%'
+	  {   249,  26,  23,  31,    2,  -23 }, // '&'
+	  {   324,   4,   6,   8,    2,  -23 }, // '''
+	  {   327,   6,  23,  10,    2,  -23 }, // '('
+	  {   345,   6,  23,  10,    2,  -23 }, // ')'
+	  {   363,  14,  14,  17,    1,  -23 }, // '*'
+	  {   388,  13,  13,  15,    1,  -16 }, // '+'
+	  {   410,   4,   8,   8,    2,   -4 }, // ','
+	  {   414,  13,   5,  18,    2,  -12 }, // '-'
+	  {   423,   4,   4,   8,    2,   -4 }, // '.'
+	  {   425,  17,  23,  18,    0,  -23 }, // '/'
+	  {   474,  23,  23,  28,    2,  -23 }, // '0'
+	  {   541,  12,  23,  14,    0,  -23 }, // '1'
+	  {   576,  23,  23,  28,    2,  -23 }, // '2'
+	  {   643,  23,  23,  27,    2,  -23 }, // '3'
+	  {   710,  22,  23,  24,    0,  -23 }, // '4'
+	  {   774,  23,  23,  28,    2,  -23 }, // '5'
+	  {   841,  23,  23,  27,    2,  -23 }, // '6'
+	  {   908,  19,  23,  22,    0,  -23 }, // '7'
+	  {   963,  23,  23,  28,    2,  -23 }, // '8'
+	  {  1030,  22,  23,  28,    2,  -23 }, // '9'
+	  {  1094,   4,  19,   8,    2,  -19 }, // ':'
+	  {  1104,   4,  23,   8,    2,  -19 }, // ';'
+	  {  1116,  14,  19,  16,    0,  -19 }, // '<'
+	  {  1150,  17,  10,  21,    2,  -14 }, // '='
+	  {  1172,  13,  19,  16,    2,  -19 }, // '>'
+	  {  1203,  20,  23,  23,    1,  -23 }, // '?'
+	  {  1261,  23,  23,  28,    2,  -23 }, // '@'
+	  {  1328,  23,  23,  28,    2,  -23 }, // 'A'
+	  {  1395,  23,  23,  28,    2,  -23 }, // 'B'
+	  {  1462,  23,  23,  27,    2,  -23 }, // 'C'
+	  {  1529,  23,  23,  28,    2,  -23 }, // 'D'
+	  {  1596,  21,  23,  26,    2,  -23 }, // 'E'
+	  {  1657,  21,  23,  24,    2,  -23 }, // 'F'
+	  {  1718,  23,  23,  28,    2,  -23 }, // 'G'
+	  {  1785,  23,  23,  28,    2,  -23 }, // 'H'
+	  {  1852,   4,  23,   8,    2,  -23 }, // 'I'
+	  {  1864,  23,  23,  26,    0,  -23 }, // 'J'
+	  {  1931,  22,  23,  27,    2,  -23 }, // 'K'
+	  {  1995,  23,  23,  26,    2,  -23 }, // 'L'
+	  {  2062,  26,  23,  31,    2,  -23 }, // 'M'
+	  {  2137,  23,  23,  28,    2,  -23 }, // 'N'
+	  {  2204,  23,  23,  28,    2,  -23 }, // 'O'
+	  {  2271,  23,  23,  26,    2,  -23 }, // 'P'
+	  {  2338,  26,  23,  29,    2,  -23 }, // 'Q'
+	  {  2413,  23,  23,  27,    2,  -23 }, // 'R'
+	  {  2480,  23,  23,  27,    2,  -23 }, // 'S'
+	  {  2547,  23,  23,  25,    1,  -23 }, // 'T'
+	  {  2614,  23,  23,  28,    2,  -23 }, // 'U'
+	  {  2681,  31,  23,  33,    1,  -23 }, // 'V'
+	  {  2771,  35,  23,  39,    1,  -23 }, // 'W'
+	  {  2872,  24,  23,  27,    1,  -23 }, // 'X'
+	  {  2941,  25,  23,  27,    1,  -23 }, // 'Y'
+	  {  3013,  23,  23,  27,    2,  -23 }, // 'Z'
+	  {  3080,   6,  23,  10,    2,  -23 }, // '['
+	  {  3098,  17,  23,  18,    0,  -23 }, // '\'
+	  {  3147,   6,  23,  10,    2,  -23 }, // ']'
+	  {  3165,   1,   1,   1,    0,   -1 }, // '^'
+	  {  3166,  23,   4,  28,    2,    0 }, // '_'
+	  {  3178,   6,   6,   8,    1,  -31 }, // '`'
+	  {  3183,  19,  19,  23,    2,  -19 }, // 'a'
+	  {  3229,  19,  25,  22,    2,  -25 }, // 'b'
+	  {  3289,  18,  19,  23,    2,  -19 }, // 'c'
+	  {  3332,  19,  25,  22,    1,  -25 }, // 'd'
+	  {  3392,  18,  19,  23,    2,  -19 }, // 'e'
+	  {  3435,  11,  25,  15,    2,  -25 }, // 'f'
+	  {  3470,  19,  26,  23,    1,  -19 }, // 'g'
+	  {  3532,  19,  25,  22,    2,  -25 }, // 'h'
+	  {  3592,   4,  25,   8,    2,  -25 }, // 'i'
+	  {  3605,  12,  32,   9,   -6,  -25 }, // 'j'
+	  {  3653,  18,  25,  22,    2,  -25 }, // 'k'
+	  {  3710,   8,  25,  12,    2,  -25 }, // 'l'
+	  {  3735,  27,  19,  32,    2,  -19 }, // 'm'
+	  {  3800,  19,  19,  23,    2,  -19 }, // 'n'
+	  {  3846,  18,  19,  23,    2,  -19 }, // 'o'
+	  {  3889,  19,  26,  22,    2,  -19 }, // 'p'
+	  {  3951,  19,  26,  22,    1,  -19 }, // 'q'
+	  {  4013,  14,  19,  18,    2,  -19 }, // 'r'
+	  {  4047,  18,  19,  23,    2,  -19 }, // 's'
+	  {  4090,  11,  25,  15,    2,  -25 }, // 't'
+	  {  4125,  19,  19,  23,    2,  -19 }, // 'u'
+	  {  4171,  24,  19,  26,    1,  -19 }, // 'v'
+	  {  4228,  32,  19,  35,    1,  -19 }, // 'w'
+	  {  4304,  20,  19,  23,    1,  -19 }, // 'x'
+	  {  4352,  19,  26,  23,    1,  -19 }, // 'y'
+	  {  4414,  19,  19,  23,    2,  -19 }, // 'z'
+	  {  4460,   7,  23,  10,    1,  -23 }, // '{'
+	  {  4481,   4,  29,   8,    2,  -26 }, // '|'
+	  {  4496,   7,  23,  10,    2,  -23 } // '}'
+};
+const GFXfont Orbitron_Bold_32 PROGMEM = {
+(uint8_t  *)Orbitron_Bold_32Bitmaps,(GFXglyph *)Orbitron_Bold_32Glyphs,0x20, 0x7E, 32};
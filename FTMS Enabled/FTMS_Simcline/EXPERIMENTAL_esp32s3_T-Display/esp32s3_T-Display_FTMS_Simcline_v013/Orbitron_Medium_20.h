@@ -0,0 +1,199 @@
+// Created by http://oleddisplay.squix.ch/ Consider a donation
+// In case of problems make sure that you are using the font file with the correct version!
+const uint8_t Orbitron_Medium_20Bitmaps[] PROGMEM = {
+
+	// Bitmap Data:
+	0x00, // ' '
+	0xDB,0x6D,0xB6,0xD8,0x0D,0x80, // '!'
+	0xDB,0x6D,0x80, // '"'
+	0x06,0x1C,0x1C,0x30,0x30,0x67,0xFF,0xEF,0xFF,0xC3,0x06,0x06,0x18,0x1C,0x30,0x30,0x61,0xFF,0xFB,0xFF,0xF3,0x06,0x06,0x1C,0x1C,0x30,0x00, // '#'
+	0x03,0x00,0x06,0x00,0x0C,0x07,0xFF,0xCF,0xFF,0xD8,0x61,0xB0,0xC0,0x61,0x80,0xC3,0x01,0xFF,0xF1,0xFF,0xF0,0x18,0x60,0x30,0xC0,0x61,0xB0,0xC3,0x7F,0xFE,0x7F,0xF8,0x06,0x00,0x0C,0x00, // '$'
+	0x7C,0x01,0x31,0x81,0xCC,0x60,0xF3,0x18,0x70,0xC6,0x38,0x1F,0x1C,0x00,0x0E,0x00,0x0F,0x3C,0x07,0x1F,0x83,0x8C,0x21,0xC3,0x08,0xE0,0xC2,0x30,0x1F,0x88,0x07,0xC0, // '%'
+	0x7F,0xF8,0x1F,0xFF,0x06,0x00,0xC1,0x80,0x00,0x60,0x00,0x1C,0x00,0x0F,0xC0,0x03,0x3C,0x30,0xC3,0xCC,0x30,0x3F,0x0C,0x03,0xE3,0x00,0x3C,0xFF,0xFF,0x9F,0xFE,0x20, // '&'
+	0xDB,0x00, // '''
+	0x6E,0xCC,0xCC,0xCC,0xCC,0xCC,0xE6, // '('
+	0xE7,0x1C,0xE7,0x39,0xCE,0x73,0x9C,0xEE,0x60, // ')'
+	0x18,0x0C,0x3F,0xDF,0xE3,0xC3,0xE1,0xB8,0x48, // '*'
+	0x18,0x0C,0x06,0x1F,0xEF,0xF0,0xC0,0x60,0x30, // '+'
+	0xDB,0x68, // ','
+	0xFF,0x7F,0x80, // '-'
+	0xD8, // '.'
+	0x00,0x40,0x18,0x03,0x00,0xC0,0x30,0x0E,0x03,0x80,0xE0,0x18,0x06,0x01,0x80,0x70,0x0C,0x01,0x00,0x00, // '/'
+	0x7F,0xFC,0xFF,0xFC,0xC0,0x1E,0xC0,0x3E,0xC0,0xFE,0xC1,0xEE,0xC3,0x8E,0xC7,0x0E,0xCE,0x0E,0xFC,0x0E,0xF8,0x0E,0xE0,0x0E,0xFF,0xFC,0x7F,0xF8, // '0'
+	0x1E,0x3E,0x3E,0x7E,0x8E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E,0x0E, // '1'
+	0x7F,0xFC,0xFF,0xFC,0xC0,0x0E,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x7F,0xFC,0xFF,0xFC,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xFF,0xFE,0xFF,0xFE, // '2'
+	0x7F,0xF9,0xFF,0xFB,0x00,0x30,0x00,0x60,0x00,0xC0,0x01,0x87,0xFF,0x0F,0xFE,0x00,0x0C,0x00,0x18,0x00,0x36,0x00,0x6F,0xFF,0xCF,0xFF,0x00, // '3'
+	0x00,0x70,0x01,0xE0,0x0F,0xC0,0x3D,0x80,0xF3,0x03,0xC6,0x0E,0x0C,0x38,0x18,0xFF,0xFD,0xFF,0xF8,0x00,0xC0,0x01,0x80,0x03,0x00,0x06,0x00, // '4'
+	0xFF,0xFE,0xFF,0xFE,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xE0,0x00,0xFF,0xFC,0xFF,0xFC,0x00,0x0E,0x00,0x0E,0x00,0x0E,0xC0,0x0E,0xFF,0xFC,0x7F,0xF8, // '5'
+	0x7F,0xF0,0xFF,0xF0,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xE0,0x00,0xFF,0xFC,0xFF,0xFC,0xC0,0x0E,0xC0,0x0E,0xC0,0x0E,0xC0,0x0E,0xFF,0xFC,0x7F,0xF8, // '6'
+	0xFF,0xE7,0xFF,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x30,0x01,0x80,0x0C,0x00,0x60,0x03,0x00,0x18, // '7'
+	0x7F,0xFC,0xFF,0xFC,0xC0,0x0E,0xC0,0x0E,0xC0,0x0E,0xC0,0x0E,0x7F,0xFC,0xFF,0xFC,0xC0,0x0E,0xC0,0x0E,0xC0,0x0E,0xC0,0x0E,0xFF,0xFC,0x7F,0xF8, // '8'
+	0x7F,0xFD,0xFF,0xFB,0x00,0x36,0x00,0x6C,0x00,0xD8,0x01,0xBF,0xFF,0x3F,0xFE,0x00,0x0C,0x00,0x18,0x00,0x30,0x00,0x6F,0xFF,0xCF,0xFF,0x00, // '9'
+	0xD8,0x00,0x00,0x03,0x60, // ':'
+	0xD8,0x00,0x00,0x03,0x6D,0xA0, // ';'
+	0x01,0x01,0x83,0xC3,0xC7,0x87,0x83,0x80,0xF0,0x3E,0x07,0x80,0xC0,0x20, // '<'
+	0xFF,0xEF,0xFE,0x00,0x00,0x00,0xFF,0xEF,0xFE, // '='
+	0x80,0x60,0x3C,0x0F,0x81,0xE0,0x38,0x1C,0x1E,0x3C,0x78,0x38,0x10,0x00, // '>'
+	0xFF,0xF7,0xFF,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x7F,0xC7,0xFE,0x30,0x01,0x80,0x00,0x00,0x00,0x03,0x00,0x18,0x00, // '?'
+	0x7F,0xFC,0xFF,0xFC,0xC0,0x0E,0xC3,0x8E,0xCF,0xCE,0xCC,0x6E,0xCC,0x6E,0xCC,0x6E,0xCF,0xFE,0xC7,0xFE,0xC0,0x00,0xC0,0x00,0xFF,0xFE,0x7F,0xFE, // '@'
+	0x7F,0xFC,0xFF,0xFC,0xC0,0x0E,0xC0,0x0E,0xC0,0x0E,0xC0,0x0E,0xC0,0x0E,0xFF,0xFE,0xFF,0xFE,0xC0,0x0E,0xC0,0x0E,0xC0,0x0E,0xC0,0x0E,0xC0,0x0E, // 'A'
+	0xFF,0xF8,0xFF,0xFC,0xC0,0x0C,0xC0,0x0C,0xC0,0x0C,0xE0,0x0C,0xFF,0xFC,0xFF,0xFC,0xC0,0x0E,0xC0,0x0E,0xC0,0x0E,0xC0,0x0E,0xFF,0xFC,0xFF,0xFC, // 'B'
+	0x7F,0xFD,0xFF,0xFB,0x00,0x06,0x00,0x0C,0x00,0x18,0x00,0x30,0x00,0x60,0x00,0xC0,0x01,0x80,0x03,0x00,0x06,0x00,0x0F,0xFF,0xCF,0xFF,0x80, // 'C'
+	0xFF,0xFC,0xFF,0xFC,0xC0,0x0E,0xC0,0x0E,0xC0,0x0E,0xC0,0x0E,0xC0,0x0E,0xC0,0x0E,0xC0,0x0E,0xC0,0x0E,0xC0,0x0E,0xC0,0x0E,0xFF,0xFC,0xFF,0xFC, // 'D'
+	0xFF,0xFB,0xFF,0xEC,0x00,0x30,0x00,0xC0,0x03,0x00,0x0F,0xFE,0x3F,0xF8,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xFF,0xFB,0xFF,0xE0, // 'E'
+	0xFF,0xFB,0xFF,0xEC,0x00,0x30,0x00,0xC0,0x03,0x00,0x0F,0xFE,0x3F,0xF8,0xC0,0x03,0x00,0x0C,0x00,0x30,0x00,0xC0,0x03,0x00,0x00, // 'F'
+	0x7F,0xFC,0xFF,0xFC,0xC0,0x0E,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x7E,0xC0,0x7E,0xC0,0x0E,0xC0,0x0E,0xC0,0x0E,0xC0,0x0E,0xFF,0xFC,0x7F,0xF8, // 'G'
+	0xC0,0x06,0xC0,0x06,0xC0,0x06,0xC0,0x06,0xC0,0x06,0xC0,0x06,0xFF,0xFE,0xFF,0xFE,0xC0,0x06,0xC0,0x06,0xC0,0x06,0xC0,0x06,0xC0,0x06,0xC0,0x06, // 'H'
+	0xDB,0x6D,0xB6,0xDB,0x6D,0x80, // 'I'
+	0x00,0x0C,0x00,0x18,0x00,0x30,0x00,0x60,0x00,0xC0,0x01,0x80,0x03,0x00,0x06,0x00,0x0C,0x00,0x1B,0x00,0x36,0x00,0x6F,0xFF,0xCF,0xFF,0x00, // 'J'
+	0xC0,0x1D,0x80,0x73,0x01,0xC6,0x07,0x0C,0x1C,0x18,0x70,0x3F,0xC0,0x7F,0xC0,0xC1,0xC1,0x81,0x83,0x03,0x86,0x03,0x8C,0x03,0x98,0x03,0x80, // 'K'
+	0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xFF,0xFE,0xFF,0xFE, // 'L'
+	0xE0,0x07,0x78,0x07,0xBE,0x07,0xDB,0x83,0x6C,0xE3,0xB6,0x3B,0x9B,0x0F,0x8D,0x87,0x86,0xC1,0x83,0x60,0x41,0xB0,0x00,0xD8,0x00,0x6C,0x00,0x36,0x00,0x18, // 'M'
+	0xE0,0x0E,0xF0,0x0E,0xF8,0x0E,0xDC,0x0E,0xCE,0x0E,0xC7,0x0E,0xC3,0x0E,0xC3,0x8E,0xC1,0xCE,0xC0,0xEE,0xC0,0x7E,0xC0,0x3E,0xC0,0x1E,0xC0,0x0E, // 'N'
+	0x7F,0xFD,0xFF,0xFB,0x00,0x36,0x00,0x6C,0x00,0xD8,0x01,0xB0,0x03,0x60,0x06,0xC0,0x0D,0x80,0x1B,0x00,0x36,0x00,0x6F,0xFF,0xCF,0xFF,0x00, // 'O'
+	0xFF,0xFC,0xFF,0xFC,0xC0,0x0E,0xC0,0x0E,0xC0,0x0E,0xC0,0x0E,0xC0,0x0E,0xFF,0xFC,0xFF,0xF8,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00,0xC0,0x00, // 'P'
+	0x7F,0xFC,0x7F,0xFE,0x30,0x03,0x18,0x01,0x8C,0x00,0xC6,0x00,0x63,0x00,0x31,0x80,0x18,0xC0,0x0C,0x60,0x06,0x30,0x03,0x18,0x01,0x8F,0xFF,0xF3,0xFF,0xF8, // 'Q'
+	0xFF,0xFC,0xFF,0xFC,0xC0,0x0E,0xC0,0x0E,0xC0,0x0E,0xC0,0x0E,0xC0,0x0C,0xFF,0xFC,0xFF,0xF8,0xC0,0xE0,0xC0,0x70,0xC0,0x38,0xC0,0x18,0xC0,0x0E, // 'R'
+	0x7F,0xFD,0xFF,0xFB,0x00,0x36,0x00,0x0C,0x00,0x18,0x00,0x3F,0xFF,0x3F,0xFE,0x00,0x0C,0x00,0x18,0x00,0x36,0x00,0x6F,0xFF,0xCF,0xFF,0x00, // 'S'
+	0xFF,0xFE,0xFF,0xFE,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80, // 'T'
+	0xC0,0x0D,0x80,0x1B,0x00,0x36,0x00,0x6C,0x00,0xD8,0x01,0xB0,0x03,0x60,0x06,0xC0,0x0D,0x80,0x1B,0x00,0x36,0x00,0x6F,0xFF,0xCF,0xFF,0x00, // 'U'
+	0xE0,0x01,0xCC,0x00,0x31,0xC0,0x0E,0x18,0x01,0x81,0x80,0x70,0x38,0x0C,0x03,0x03,0x80,0x70,0xE0,0x06,0x18,0x00,0xE7,0x00,0x0C,0xC0,0x00,0xF8,0x00,0x1E,0x00,0x01,0x80,0x00, // 'V'
+	0xC0,0x70,0x1D,0xC0,0xF0,0x31,0x81,0xE0,0x63,0x07,0xC1,0x87,0x0D,0xC3,0x06,0x39,0x8E,0x0E,0x63,0x18,0x0C,0xC3,0x30,0x1B,0x86,0xE0,0x3E,0x0F,0x80,0x3C,0x0F,0x00,0x78,0x1E,0x00,0xE0,0x38,0x00,0xC0,0x30,0x00, // 'W'
+	0xE0,0x1C,0xE0,0x70,0xE1,0xC0,0xE7,0x00,0xEC,0x00,0xF8,0x01,0xE0,0x03,0xC0,0x0F,0xC0,0x39,0xC0,0x61,0xC1,0xC1,0x87,0x01,0x9C,0x03,0x80, // 'X'
+	0xF0,0x07,0x18,0x06,0x0E,0x07,0x03,0x87,0x00,0xE7,0x00,0x3B,0x00,0x1F,0x80,0x07,0x80,0x01,0x80,0x00,0xC0,0x00,0x60,0x00,0x30,0x00,0x18,0x00,0x0C,0x00, // 'Y'
+	0xFF,0xFD,0xFF,0xF8,0x00,0x70,0x03,0xC0,0x0F,0x00,0x38,0x00,0xE0,0x03,0x80,0x0E,0x00,0x78,0x01,0xE0,0x07,0x00,0x0F,0xFF,0xDF,0xFF,0x80, // 'Z'
+	0xF7,0xB1,0x8C,0x63,0x18,0xC6,0x31,0x8F,0x78, // '['
+	0x80,0x18,0x03,0x80,0x38,0x03,0x80,0x30,0x03,0x00,0x30,0x07,0x00,0x70,0x07,0x00,0x60,0x04,0x00,0x80, // '\'
+	0xEE,0x66,0x66,0x66,0x66,0x66,0xEE, // ']'
+	0x00, // '^'
+	0xFF,0xFD,0xFF,0xF8, // '_'
+	0xCC,0xE0, // '`'
+	0xFF,0xC7,0xFF,0x3F,0xFC,0x00,0x60,0x03,0x7F,0xFB,0xFF,0xD8,0x06,0xC0,0x36,0x01,0xBF,0xFC,0xFF,0xE0, // 'a'
+	0xC0,0x06,0x00,0x30,0x01,0xFF,0x8F,0xFE,0x7F,0xFB,0x00,0xD8,0x06,0xC0,0x36,0x01,0xB0,0x0D,0x80,0x6C,0x03,0x7F,0xFB,0xFF,0x80, // 'b'
+	0x3F,0xF7,0xFF,0xBF,0xFD,0x80,0x0C,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x3F,0xFC,0xFF,0xE0, // 'c'
+	0x00,0x30,0x01,0x80,0x0C,0x7F,0xE7,0xFF,0x7F,0xFB,0x80,0xDC,0x06,0xE0,0x37,0x01,0xB8,0x0D,0xC0,0x6E,0x03,0x3F,0xF8,0xFF,0xC0, // 'd'
+	0x3F,0xC7,0xFF,0x3F,0xFD,0x80,0x6C,0x03,0x7F,0xFB,0xFF,0xD8,0x00,0xC0,0x06,0x00,0x3F,0xFC,0xFF,0xE0, // 'e'
+	0x7E,0xFE,0xC0,0xFE,0xFE,0xFE,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0, // 'f'
+	0x3F,0xC7,0xFF,0x3F,0xFD,0x80,0xEC,0x07,0x60,0x3B,0x01,0xD8,0x0E,0xC0,0x76,0x03,0xBF,0xFC,0xFF,0xE0,0x07,0x00,0x38,0xFF,0xC7,0xFC,0x3F,0xC0, // 'g'
+	0xC0,0x06,0x00,0x30,0x01,0xFF,0x8F,0xFE,0x7F,0xFB,0x00,0xD8,0x06,0xC0,0x36,0x01,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xC0, // 'h'
+	0xD8,0x6D,0xB6,0xDB,0x6D,0xB0, // 'i'
+	0x03,0x01,0x80,0x00,0x60,0x30,0x18,0x0C,0x06,0x03,0x01,0x80,0xC0,0x60,0x30,0x18,0x0C,0x06,0x03,0x7F,0xBF,0x9F,0x80, // 'j'
+	0xC0,0x06,0x00,0x30,0x01,0x80,0xEC,0x0E,0x60,0xE3,0x0E,0x18,0xE0,0xFE,0x07,0xF0,0x31,0xC1,0x87,0x0C,0x1C,0x60,0x73,0x01,0xC0, // 'k'
+	0xC3,0x0C,0x30,0xC3,0x0C,0x30,0xC3,0x0C,0x30,0xC3,0xE7,0x80, // 'l'
+	0xFF,0xFF,0x1F,0xFF,0xF3,0xFF,0xFE,0x60,0x60,0xEC,0x0C,0x1D,0x81,0x83,0xB0,0x30,0x76,0x06,0x0E,0xC0,0xC1,0xD8,0x18,0x3B,0x03,0x07,0x60,0x60,0xE0, // 'm'
+	0xFF,0xC7,0xFF,0x3F,0xFD,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x01,0xB0,0x0D,0x80,0x60, // 'n'
+	0x3F,0xC7,0xFF,0x3F,0xFD,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x01,0xBF,0xFC,0xFF,0xC0, // 'o'
+	0xFF,0xC7,0xFF,0x3F,0xFD,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x01,0xBF,0xFD,0xFF,0xCC,0x00,0x60,0x03,0x00,0x18,0x00,0xC0,0x00, // 'p'
+	0x3F,0xF3,0xFF,0xBF,0xFD,0xC0,0x6E,0x03,0x70,0x1B,0x80,0xDC,0x06,0xE0,0x37,0x01,0x9F,0xFC,0xFF,0xE0,0x03,0x00,0x18,0x00,0xC0,0x06,0x00,0x30, // 'q'
+	0x3F,0x9F,0xEF,0xFB,0x00,0xC0,0x30,0x0C,0x03,0x00,0xC0,0x30,0x0C,0x03,0x00, // 'r'
+	0x3F,0xC7,0xFF,0x3F,0xFD,0x80,0x0C,0x00,0x7F,0xF1,0xFF,0x80,0x06,0x00,0x36,0x01,0xBF,0xFC,0xFF,0xC0, // 's'
+	0xC0,0xC0,0xC0,0xFE,0xFE,0xFE,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xC0,0xFE,0x7E, // 't'
+	0xC0,0x36,0x01,0xB0,0x0D,0x80,0x6C,0x03,0x60,0x1B,0x00,0xD8,0x06,0xC0,0x36,0x01,0xBF,0xFC,0xFF,0xC0, // 'u'
+	0xE0,0x06,0x70,0x0E,0x30,0x0C,0x38,0x1C,0x18,0x18,0x1C,0x38,0x0C,0x30,0x0E,0x60,0x06,0xE0,0x07,0xC0,0x03,0xC0,0x01,0x80, // 'v'
+	0xC0,0xE0,0x76,0x07,0x03,0x18,0x3C,0x18,0xC3,0xE1,0xC7,0x1B,0x8C,0x19,0xCC,0xE0,0xCC,0x76,0x07,0xE1,0xB0,0x1F,0x0F,0x80,0xF0,0x78,0x03,0x81,0xC0,0x18,0x0E,0x00, // 'w'
+	0xE0,0x73,0x07,0x1C,0x30,0x73,0x81,0xF8,0x07,0x80,0x3C,0x03,0xE0,0x19,0x81,0xCE,0x1C,0x39,0xC0,0xE0, // 'x'
+	0xC0,0x76,0x03,0xB0,0x1D,0x80,0xEC,0x07,0x60,0x3B,0x01,0xD8,0x0E,0xC0,0x76,0x03,0xBF,0xFC,0xFF,0xE0,0x07,0x00,0x38,0xFF,0xC7,0xFC,0x3F,0xC0, // 'y'
+	0xFF,0xF7,0xFF,0xBF,0xFC,0x01,0xC0,0x3C,0x03,0xC0,0x38,0x03,0x80,0x78,0x07,0x00,0x3F,0xFD,0xFF,0xE0, // 'z'
+	0x39,0xE7,0x1C,0x71,0xCC,0x38,0x71,0xC7,0x1C,0x38,0xE0, // '{'
+	0xDB,0x6D,0xB6,0xDB,0x6D,0xB6,0xDB,0x00, // '|'
+	0xE7,0x18,0xC6,0x38,0xC6,0x63,0x18,0xCE,0x60 // '}'
+};
+const GFXglyph Orbitron_Medium_20Glyphs[] PROGMEM = {
+// bitmapOffset, width, height, xAdvance, xOffset, yOffset
+	  {     0,   1,   1,   7,    0,    0 }, // ' '
+	  {     1,   3,  14,   5,    1,  -14 }, // '!'
+	  {     7,   6,   3,   8,    1,  -14 }, // '"'
+	  {    10,  15,  14,  17,    1,  -14 }, // '#'
+	  {    37,  15,  19,  17,    1,  -17 }, // '$'
+	  {    73,  18,  14,  20,    1,  -14 }, // '%'
+	  {   105,  18,  14,  20,    1,  -14 }, // '&'
+	  {   137,   3,   3,   5,    1,  -14 }, // '''
+	  {   139,   4,  14,   7,    1,  -14 }, // '('
+	  {   146,   5,  14,   7,    1,  -14 }, // ')'
+	  {   155,   9,   8,  11,    1,  -14 }, // '*'
+	  {   164,   9,   8,  10,    0,  -10 }, // '+'
+	  {   173,   3,   5,   5,    1,   -2 }, // ','
+	  {   175,   9,   2,  11,    1,   -7 }, // '-'
+	  {   178,   3,   2,   5,    1,   -2 }, // '.'
+	  {   179,  11,  14,  11,    0,  -14 }, // '/'
+	  {   199,  16,  14,  18,    1,  -14 }, // '0'
+	  {   227,   8,  14,   9,    0,  -14 }, // '1'
+	  {   241,  16,  14,  18,    1,  -14 }, // '2'
+	  {   269,  15,  14,  18,    1,  -14 }, // '3'
+	  {   296,  15,  14,  16,    0,  -14 }, // '4'
+	  {   323,  16,  14,  18,    1,  -14 }, // '5'
+	  {   351,  16,  14,  17,    1,  -14 }, // '6'
+	  {   379,  13,  14,  14,    0,  -14 }, // '7'
+	  {   402,  16,  14,  18,    1,  -14 }, // '8'
+	  {   430,  15,  14,  18,    1,  -14 }, // '9'
+	  {   457,   3,  12,   5,    1,  -12 }, // ':'
+	  {   462,   3,  15,   5,    1,  -12 }, // ';'
+	  {   468,   9,  12,  10,    0,  -12 }, // '<'
+	  {   482,  12,   6,  14,    1,   -9 }, // '='
+	  {   491,   9,  12,  11,    1,  -12 }, // '>'
+	  {   505,  13,  14,  15,    1,  -14 }, // '?'
+	  {   528,  16,  14,  18,    1,  -14 }, // '@'
+	  {   556,  16,  14,  18,    1,  -14 }, // 'A'
+	  {   584,  16,  14,  18,    1,  -14 }, // 'B'
+	  {   612,  15,  14,  17,    1,  -14 }, // 'C'
+	  {   639,  16,  14,  18,    1,  -14 }, // 'D'
+	  {   667,  14,  14,  16,    1,  -14 }, // 'E'
+	  {   692,  14,  14,  15,    1,  -14 }, // 'F'
+	  {   717,  16,  14,  18,    1,  -14 }, // 'G'
+	  {   745,  16,  14,  18,    1,  -14 }, // 'H'
+	  {   773,   3,  14,   5,    1,  -14 }, // 'I'
+	  {   779,  15,  14,  17,    0,  -14 }, // 'J'
+	  {   806,  15,  14,  17,    1,  -14 }, // 'K'
+	  {   833,  16,  14,  17,    1,  -14 }, // 'L'
+	  {   861,  17,  14,  20,    1,  -14 }, // 'M'
+	  {   891,  16,  14,  18,    1,  -14 }, // 'N'
+	  {   919,  15,  14,  18,    1,  -14 }, // 'O'
+	  {   946,  16,  14,  17,    1,  -14 }, // 'P'
+	  {   974,  17,  14,  19,    1,  -14 }, // 'Q'
+	  {  1004,  16,  14,  18,    1,  -14 }, // 'R'
+	  {  1032,  15,  14,  17,    1,  -14 }, // 'S'
+	  {  1059,  16,  14,  16,    0,  -14 }, // 'T'
+	  {  1087,  15,  14,  18,    1,  -14 }, // 'U'
+	  {  1114,  19,  14,  21,    1,  -14 }, // 'V'
+	  {  1148,  23,  14,  25,    1,  -14 }, // 'W'
+	  {  1189,  15,  14,  17,    1,  -14 }, // 'X'
+	  {  1216,  17,  14,  17,    0,  -14 }, // 'Y'
+	  {  1246,  15,  14,  17,    1,  -14 }, // 'Z'
+	  {  1273,   5,  14,   7,    1,  -14 }, // '['
+	  {  1282,  11,  14,  11,    0,  -14 }, // '\'
+	  {  1302,   4,  14,   7,    1,  -14 }, // ']'
+	  {  1309,   1,   1,   1,    0,    0 }, // '^'
+	  {  1310,  15,   2,  18,    1,    0 }, // '_'
+	  {  1314,   4,   3,   5,    1,  -20 }, // '`'
+	  {  1316,  13,  12,  15,    1,  -12 }, // 'a'
+	  {  1336,  13,  15,  14,    1,  -15 }, // 'b'
+	  {  1361,  13,  12,  15,    1,  -12 }, // 'c'
+	  {  1381,  13,  15,  14,    0,  -15 }, // 'd'
+	  {  1406,  13,  12,  15,    1,  -12 }, // 'e'
+	  {  1426,   8,  15,   9,    1,  -15 }, // 'f'
+	  {  1441,  13,  17,  15,    1,  -12 }, // 'g'
+	  {  1469,  13,  15,  14,    1,  -15 }, // 'h'
+	  {  1494,   3,  15,   5,    1,  -15 }, // 'i'
+	  {  1500,   9,  20,   6,   -4,  -15 }, // 'j'
+	  {  1523,  13,  15,  14,    1,  -15 }, // 'k'
+	  {  1548,   6,  15,   7,    1,  -15 }, // 'l'
+	  {  1560,  19,  12,  21,    1,  -12 }, // 'm'
+	  {  1589,  13,  12,  15,    1,  -12 }, // 'n'
+	  {  1609,  13,  12,  15,    1,  -12 }, // 'o'
+	  {  1629,  13,  17,  14,    1,  -12 }, // 'p'
+	  {  1657,  13,  17,  14,    0,  -12 }, // 'q'
+	  {  1685,  10,  12,  11,    1,  -12 }, // 'r'
+	  {  1700,  13,  12,  15,    1,  -12 }, // 's'
+	  {  1720,   8,  15,   9,    1,  -15 }, // 't'
+	  {  1735,  13,  12,  15,    1,  -12 }, // 'u'
+	  {  1755,  16,  12,  17,    0,  -12 }, // 'v'
+	  {  1779,  21,  12,  22,    1,  -12 }, // 'w'
+	  {  1811,  13,  12,  15,    1,  -12 }, // 'x'
+	  {  1831,  13,  17,  15,    1,  -12 }, // 'y'
+	  {  1859,  13,  12,  15,    1,  -12 }, // 'z'
+	  {  1879,   6,  14,   7,    0,  -14 }, // '{'
+	  {  1890,   3,  19,   5,    1,  -17 }, // '|'
+	  {  1898,   5,  14,   7,    1,  -14 } // '}'
+};
+const GFXfont Orbitron_Medium_20 PROGMEM = {
+(uint8_t  *)Orbitron_Medium_20Bitmaps,(GFXglyph *)Orbitron_Medium_20Glyphs,0x20, 0x7E, 20};
@@ -0,0 +1,142 @@
+/* This file contains some bitmaps that are used to display on the OLED SSD1306
+ *  Mountain_bw_79x64 is the SIMCLINE splash image
+ *  bluetooth_icon16x16 is a Buetooth icon shown when smartphone is connected
+ */
+ 
+const unsigned char Mountain_bw_79x64[] PROGMEM = {
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf0,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x07, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x3c, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x1e, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x0e, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x38, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x07,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xf0, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x03, 0xc0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe0, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+0xc0, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0xc0, 0xe0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x07, 0x81, 0xe0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x83, 0xf0,
+0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xcf, 0xfd, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x0f, 0xff, 0x3f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xfe, 0x1f, 0xfc, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x7c, 0x0f, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x38,
+0x38, 0x07, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x78, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x78, 0x70, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xf0, 0x00, 0x00,
+0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00,
+0xef, 0xe0, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x01, 0xe7, 0xc0, 0x00, 0x00, 0x01, 0xc0,
+0x00, 0x00, 0x00, 0x01, 0xc3, 0x80, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x03, 0xc1, 0x80,
+0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00,
+0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x78, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x1e,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x20, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c,
+0x70, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0e, 0xf8, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00,
+0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xfc, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x07, 0xde, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8e, 0x00, 0x01, 0xe0,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+0x07, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x03, 0x80, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0,
+0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x01, 0xe0, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x1c, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const unsigned char bluetooth_icon16x16[] PROGMEM = {
+  0b00000000, 0b00000000, //                 
+  0b00000001, 0b10000000, //        ##       
+  0b00000001, 0b11000000, //        ###      
+  0b00000001, 0b01100000, //        # ##     
+  0b00001001, 0b00110000, //     #  #  ##    
+  0b00001101, 0b00110000, //     ## #  ##    
+  0b00000111, 0b01100000, //      ### ##     
+  0b00000011, 0b11000000, //       ####      
+  0b00000001, 0b10000000, //        ##       
+  0b00000011, 0b11000000, //       ####      
+  0b00000111, 0b01100000, //      ### ##     
+  0b00001101, 0b00110000, //     ## #  ##    
+  0b00001001, 0b00110000, //     #  #  ##    
+  0b00000001, 0b01100000, //        # ##     
+  0b00000001, 0b11000000, //        ###      
+  0b00000001, 0b10000000, //        ##       
+};
+
+const unsigned char zwift_icon16x16[] PROGMEM = {
+  0b00000000,0b00000000, // 
+  0b00000000,0b00000000, // 
+  0b01111111,0b11111111, // ###############
+  0b11111111,0b11111110, //###############    
+  0b11111111,0b11111100, //##############  
+  0b01111111,0b11111000, // ############
+  0b00000111,0b11110000, //     #######
+  0b00001111,0b11100000, //    #######
+  0b00011111,0b11000000, //   #######
+  0b00111111,0b10000000, //  #######
+  0b01111111,0b11111110, // ##############
+  0b11111111,0b11111111, //################
+  0b11111111,0b11111111, //################
+  0b01111111,0b11111110, // ##############
+  0b00000000,0b00000000, // 
+  0b00000000,0b00000000, //0123456789012345       
+};
+
+const unsigned char mobile_icon16x16[] PROGMEM = {
+  0b00000000, 0b00000000, //                 
+  0b00000000, 0b00110000, //           ##    
+  0b00000000, 0b00110000, //           ##    
+  0b00001111, 0b11111000, //     #########   
+  0b00001111, 0b11111000, //     #########   
+  0b00001100, 0b00011000, //     ##     ##   
+  0b00001100, 0b00011000, //     ##     ##   
+  0b00001100, 0b00011000, //     ##     ##   
+  0b00001100, 0b00011000, //     ##     ##   
+  0b00001111, 0b11111000, //     #########   
+  0b00001111, 0b11111000, //     #########   
+  0b00001111, 0b11111000, //     #########   
+  0b00001111, 0b11111000, //     #########   
+  0b00001111, 0b11111000, //     #########   
+  0b00001111, 0b11111000, //     #########   
+  0b00000000, 0b00000000, //  
+};
+/*
+const unsigned char power_icon16x16[] PROGMEM = {
+  0b00000000, 0b00000001, //                 
+  0b00000000, 0b00000011, //                1
+  0b00000001, 0b10000111, //               1
+  0b00000011, 0b11001110, //              11
+  0b00001111, 0b11111110, //       ####  111
+  0b00111101, 0b00011100, //    ####  ####1 
+  0b01110011, 0b00111110, //  ###  1   11###
+  0b11100111, 0b11110111, // ###  111 111 ###
+  0b11101111, 0b11100111, // ### 111 111  ###
+  0b01111100, 0b11001110, //  ###11   1  ###
+  0b00111000, 0b10111100, //   1####  #### 
+  0b01111111, 0b11110000, //  111  #### 
+  0b01110011, 0b11000000, //  11      
+  0b11100001, 0b10000000, //  1       
+  0b11000000, 0b00000000, // 1          
+  0b10000000, 0b00000000, // 0123456789012345                
+};
+*/
+const unsigned char power_icon16x16[] PROGMEM = {
+  0b00000000, 0b10000000, //          #                 
+  0b00000001, 0b10000000, //         ##      
+  0b00000011, 0b10000000, //        ###    
+  0b00000111, 0b10000000, //       ####
+  0b00001111, 0b10000000, //      #####      
+  0b00011111, 0b10000000, //     ######         
+  0b00111111, 0b11111111, //    #############  
+  0b01111111, 0b11111110, //   #############  
+  0b11111111, 0b11111100, //  #############   
+  0b00000011, 0b11111000, //        ######    
+  0b00000011, 0b11110000, //        #####    
+  0b00000011, 0b11100000, //        ####           
+  0b00000011, 0b11000000, //        ###             
+  0b00000011, 0b10000000, //        ##                 
+  0b00000011, 0b00000000, //        #        
+  0b00000010, 0b00000000, // 0123456789012345                
+};
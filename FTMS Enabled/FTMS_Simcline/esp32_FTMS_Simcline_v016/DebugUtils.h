@@ -0,0 +1,18 @@
+/*
+DebugUtils.h - Simple debugging utilities.
+*/
+
+#ifndef DEBUGUTILS_H
+#define DEBUGUTILS_H
+
+#ifdef DEBUG
+  #define DEBUG_PRINT(...) Serial.print(__VA_ARGS__)
+  #define DEBUG_PRINTF(...) Serial.printf(__VA_ARGS__)
+  #define DEBUG_PRINTLN(...) Serial.println(__VA_ARGS__)
+#else
+  #define DEBUG_PRINT(...)
+  #define DEBUG_PRINTF(...)
+  #define DEBUG_PRINTLN(...)
+#endif
+
+#endif
@@ -0,0 +1,4338 @@
+/*********************************************************************
+ This is programming code for ESP32 Espressif Wroom boards
+ 
+      Tested with Adafruit Feather ESP32 V2 a.k.a. Huzzah
+ 
+ The code uses heavily the supplied ESP32 NimBLE libraries !!          
+      see: https://github.com/h2zero/NimBLE-Arduino
+ Many have invested time and resources providing open source code!
+ 
+        MIT license, check LICENSE for more information
+        All text must be included in any redistribution
+*********************************************************************/
+
+
+/* -----------------------------------------------------------------------------------------------------
+ *             This code should work with all indoor cycling trainers that fully support,
+ *        Fitness Machine Service, Cycling Power Service and Cycling Speed & Cadence Service
+ * ------------------------------------------------------------------------------------------------------
+ *
+ *  The code links a BLE Server (a peripheral to Zwift) and a BLE Client (a central to the Trainer) with a bridge 
+ *  in between, the ESP32 being man-in-the-middle (MITM). The ESP32 is an integral part of the Simcline,
+ *  that interprets the exchanged road grade and moves the front wheel up and down with the change in inclination.
+ *  The ESP32-bridge can control, filter and alter the bi-directional interchanged data!
+ *  The client-side (central) scans and connects with the trainer relevant services: FTMS, CPS and CSC. It collects 
+ *  all cyling data of the services and passes these on to the server-side....  
+ *  The client-side supplies the indoor trainer with target and resistance control data.
+ *  The server-side (peripheral) advertises and enables connection with cycling apps like Zwift and collects the app's  
+ *  control commands, target and resistance data. It passes these on to the client-side....  
+ *  The server-side supplies the app with the generated cycling data in return. 
+ *  
+ *  The client plus server (MITM) are transparent to the indoor trainer as well as to the training app Zwift or alike!
+ *  
+ *  Requirements: Zwift app or alike, operational Simcline and a FTMS/CPS/CSC/HBM supporting indoor trainer
+ *  0) Upload and Run this code on the Simcline (i.c. ESP32 board)
+ *  1) Start the Serial Monitor to catch debugging info and check the Oled display
+ *  2) The code will do basic testing of mechanical parts and sensors
+ *  3) Start/Power On the indoor trainer  
+ *  4) Simcline and trainer (with <name>) will pair as reported in the output
+ *  5) Start Zwift on your computer or tablet and wait....
+ *  6) Search on the Zwift pairing screens for the Simcline a.k.a. <SIM32>
+ *  7) Pair: Power, Cadence and Controllable one after another with <SIM32>
+ *  8) Optionally one can pair as well devices for heartrate and/or steering (Sterzo)
+ *  9) Start the default Zwift ride or any ride you wish
+ * 10) Make Serial Monitor output window visible on top of the Zwift window 
+ * 11) Hop on the bike: do the work and feel resistance change with the road
+ * 12) Inspect the info presented by Serial Monitor.....
+ *  
+ *
+ *   This device is identified with the name <SIM32>. You will see this only when connecting to Zwift on the 
+ *   pairing screens! Notice: Zwift extends device names with additional numbers for identification!
+ *  
+ */
+/*
+Version 1.1
+Changed Stack Depth values from 2048 to 4096 for Server Control Point Indicate (modified) and Write w Response
+Version 1.2
+Inserted check (boolean) on Control Point Write-Response out of synch...
+Version 1.3 
+Cycling Speed Cadence Service changed to NOT Mandatory
+Version 1.4
+Inserted checks on the input values of sensor location and location description array sizes (CP, CSC and HBM)
+Version 1.5
+Corrected invalid (enable/disable) setting of HR measurement Characteristic in client_Set_All_NotificationIndication()
+Changed device identification naming to a simpler scheme: SIM32 or SIM52 instead of <SIM DevName>
+Server Characteristic values (read only) are now updated when a new client connection is established
+NimBLE registerForNotify() has been deprecated and is replaced with subscribe() / unsubscribe()
+Version 1.6
+Oled screens are queued and shown by a Screen Sequencer task, no more blocking delay() calls in the display functions
+Road Grade screen is built with retained-mode widgets: only changed widgets are redrawn and only their region is flushed
+Road Grade screen updates are merged and paced by a render scheduler (max FPS and min idle interval)
+Control Point commands are queued to one long-lived writer task (no task creation per command), enqueue-to-ack latency is recorded
+Control Point commands are coalesced per opcode (latest wins) and sent on the trainer's ack, no more skipping when out of synch
+Control Point writes are retried (ack timeout, jittered delay), the trainer is only disconnected after consecutive failures
+Trainer notifications are pushed in a lock-free ring per characteristic and forwarded to the app by a Notify Forwarder task
+Forwarded notifications are sent directly from the ring buffer to the subscribed app, no more copy in the server attribute
+Latency of every bridge hop is aggregated in fixed bucket histograms, readable over NUS (!L) and Serial
+Connection parameters of the trainer and app links follow a policy: fast while Control Point commands flow, relaxed when idle
+Both links negotiate the largest ATT MTU and LE Data Length, forwarding and NUS packets respect the MTU of each link
+Notifications fan out to every subscribed central (subscription table per connection) with flow control per central
+Forwarded samples are rate limited per characteristic (latest or averaged over the window), saved airtime is reported
+Trainer handles and static values are cached in LittleFS per trainer, a reconnect with a matching Database Hash skips discovery
+  Notice: a trainer without a Database Hash cannot tell that its handles have changed, the cache is then trusted until a
+  CCCD write fails. After a firmware update of such a trainer a CCCD write to a moved handle can still succeed, with missing
+  or wrong data as a result --> remove /gatt_<trainer address>.bin from LittleFS (or reflash) after a trainer update!
+The last used trainer address is remembered and connected to directly at boot and after a disconnect, scanning is the fallback
+loop() runs a connection state machine that blocks on an event group and reacts immediately, no more flag polling with delay()
+Trainer CCCD's are written by handle and pipelined in the NimBLE host task, failed writes are retried one by one
+Discovery is prioritised: FTMS and CP make the trainer ready for riding, optional services follow in the background
+The trainer is searched for in the background with exponential backoff, no more halt when it is not found at boot
+Scanned trainers are collected for a short window and ranked (remembered, services, RSSI), scan timing adapts per attempt
+Advertising is fast after boot or a disconnect and slow after that, all services and the name are in adv plus scan response
+BLE callback objects and the trainer client are allocated once, Control Point and NUS writes use fixed buffers, heap is tracked
+All tasks are started from one placement table (core, priority, stack), stack, wake-up latency and CPU usage are reported
+*/
+// -------------------------------------------------------------------------------------------
+// COMPILER DIRECTIVE to allow/suppress DEBUG messages that help debugging...
+// Uncomment general "#define DEBUG" to activate
+#define DEBUG
+// Include these debug utility macros in all cases!
+#include "DebugUtils.h"
+#ifdef DEBUG
+//  Restrict activating one or more of the following DEBUG directives --> process intensive 
+//  The overhead can lead to spurious side effects and a loss of quality of service handling!!
+//#define DEBUG_HBM               // If defined allows for parsing and decoding the Heart Beat Data
+//#define DEBUG_CP_MEASUREMENT    // If defined allows for parsing and decoding the Cycling Power Data
+//#define DEBUG_CSC_MEASUREMENT   // If defined allows for parsing and decoding the Cycling Speed and Cadence Data
+//#define DEBUG_FTM_INDOORBIKEDATA// If defined allows for parsing the Indoor Bike Data
+#ifdef DEBUG_FTM_INDOORBIKEDATA
+//#define DEBUG_DECODE_IBD        // If defined allows for decoding the Indoor Bike Data
+#endif
+//#define DEBUG_FTM_TRAININGSTATUS// If defined allows for parsing the Training Status Data
+//#define DEBUG_FTM_STATUS        // If defined allows for parsing the Machine Status Data
+#define DEBUG_FTM_CONTROLPOINT_RESPONSE     // If defined allows for parsing the Data
+#define DEBUG_FTM_CONTROLPOINT_OPCODE_DATA  // If defined allows for parsing and decoding Data
+//#define MOVEMENTDEBUG 
+//#define DEBUG_OLED_WIDGETS      // If defined allows for reporting the dirty region and bytes flushed per Oled update
+//#define DEBUG_RENDER_SCHEDULER  // If defined allows for reporting achieved FPS, render cost and dropped frames
+//#define DEBUG_CONTROLPOINT_LATENCY // If defined allows for reporting Control Point enqueue-to-ack latency
+//#define DEBUG_NOTIFY_FORWARDING // If defined allows for reporting ring depth and drop counters of forwarded notifications
+//#define DEBUG_BRIDGE_LATENCY    // If defined allows for reporting the bridge latency histograms every minute
+#endif
+// --------------------------------------------------------------------------------------------
+#ifndef ADAFRUIT_FEATHER_ESP32_V2
+#define ADAFRUIT_FEATHER_ESP32_V2
+#endif
+
+// Exponential EMA ALPHA filter definition
+// Used to filter sequence of actuator target positions --> minimize consecutive small up/down movements
+// Should be between low (10-40) is maximal and high (50-90) is minimal filtering
+// Uncomment "#define EMA_ALPHA" to activate
+//#define EMA_ALPHA 60    // Value is in percentage 0-99. 
+
+#define 	BLE_APPEARANCE_GENERIC_CYCLING   1152
+
+#include <NimBLEDevice.h>
+// We need this for setting the Server-side Generic Access Char's --> Appearance and DeviceName
+#include <nimble/nimble/host/services/gap/include/services/gap/ble_svc_gap.h>
+
+#define THISDEVICENAME "SIM32" // Shortname 
+
+const uint8_t MAX_PAYLOAD = 20; // Max 20 byte data size for single packet BLE transfer (default MTU of 23)
+// Preferred ATT MTU and LE Data Length (DLE) that are negotiated on both links:
+// an ATT packet of the preferred MTU fits in one link layer packet of the preferred data length
+#define PREFERRED_DATA_LEN 251  // Max LE Data Length octets
+#define PREFERRED_MTU      247  // PREFERRED_DATA_LEN minus 4 octets L2CAP header
+
+// Struct containing Device info to administer dis/connected devices
+typedef struct
+{
+  uint8_t PeerAddress[6];
+  std::string PeerName;
+  uint16_t conn_handle;
+  bool IsConnected;
+} Device_info_t;
+// -----------------------------------------------------------------
+// Your hardware MAC/DEVICE ADDRESSES
+// Laptop/Desktop Device Address that runs Zwift, in printed format: [00:01:02:03:04:05]
+// NimBLE demands you to enter addresses here in Little Endian format (reversed order)
+#define LAPTOPADDRESS {0x05,0x04,0x03,0x02,0x01,0x00} // Little Endian format!!
+// Trainer FTMS enabled Device Address, in printed format: [00:01:02:03:04:05]
+// Leave the placeholder unchanged to connect to the first FTMS trainer that is found, it is remembered after that!
+#define TRAINERADDRESS {0x05,0x04,0x03,0x02,0x01,0x00} // Little Endian format!!
+// -----------------------------------------------------------------
+// Initialize connectable device registration
+Device_info_t Trainer    = {TRAINERADDRESS, "MyTrainer", BLE_HS_CONN_HANDLE_NONE, false};
+Device_info_t Laptop     = { LAPTOPADDRESS, "MyLaptop" , BLE_HS_CONN_HANDLE_NONE, false};
+Device_info_t Smartphone = {        {0x00}, "MyPhone"  , BLE_HS_CONN_HANDLE_NONE, false};
+// ----------------------------------------------------------------------------------
+
+// Client Generic Access --------------------------------------------------------------
+#define UUID16_SVC_GENERIC_ACCESS                             BLEUUID((uint16_t)0x1800)
+#define UUID16_CHR_DEVICE_NAME                                BLEUUID((uint16_t)0x2A00)
+#define UUID16_CHR_APPEARANCE                                 BLEUUID((uint16_t)0x2A01)
+#define UUID16_CHR_PERIPHERAL_PREFERRED_CONNECTION_PARAMETERS BLEUUID((uint16_t)0x2A04)
+#define UUID16_CHR_CENTRAL_ADDRESS_RESOLUTION                 BLEUUID((uint16_t)0x2AA6)
+#define UUID16_CHR_DATABASE_HASH                              BLEUUID((uint16_t)0x2B2A) // Generic Attribute Service
+BLERemoteService* pRemote_GenericAccess_Service;
+BLERemoteCharacteristic* pRemote_GA_Appearance_Chr; // Read
+uint16_t client_GA_Appearance_Value = BLE_APPEARANCE_GENERIC_CYCLING;  // Default decimal: 1152 -> Generic Cycling
+BLERemoteCharacteristic* pRemote_GA_DeviceName_Chr;// Read, Write
+std::string client_GA_DeviceName_Str = THISDEVICENAME;
+
+// Client Service Device Information --------------------------------------------------
+#define UUID16_SVC_DEVICE_INFORMATION                         BLEUUID((uint16_t)0x180A)
+#define UUID16_CHR_MODEL_NUMBER_STRING                        BLEUUID((uint16_t)0x2A24)
+#define UUID16_CHR_SERIAL_NUMBER_STRING                       BLEUUID((uint16_t)0x2A25)
+#define UUID16_CHR_FIRMWARE_REVISION_STRING                   BLEUUID((uint16_t)0x2A26)
+#define UUID16_CHR_HARDWARE_REVISION_STRING                   BLEUUID((uint16_t)0x2A27)
+#define UUID16_CHR_SOFTWARE_REVISION_STRING                   BLEUUID((uint16_t)0x2A28)
+#define UUID16_CHR_MANUFACTURER_NAME_STRING                   BLEUUID((uint16_t)0x2A29)
+BLERemoteService*  pRemote_DeviceInformation_Service; 
+BLERemoteCharacteristic* pRemote_DIS_ManufacturerName_Chr;   // Read
+std::string client_DIS_Manufacturer_Str;
+BLERemoteCharacteristic* pRemote_DIS_ModelNumber_Chr;       // Read
+std::string client_DIS_ModelNumber_Str;
+BLERemoteCharacteristic* pRemote_DIS_SerialNumber_Chr;      // Read
+std::string client_DIS_SerialNumber_Str;
+// -------------------------------------------------------------------------------------
+BLEService *server_DeviceInformation_Service;
+BLECharacteristic *server_DIS_ModelNumber_Chr;       // Read
+//std::string client_DIS_ModelNumber_Str = "ESP32 Feather V2";
+BLECharacteristic *server_DIS_SerialNumber_Chr;      // Read
+//std::string client_DIS_SerialNumber_Str = "12345";
+BLECharacteristic *server_DIS_Firmware_Chr;          // Read
+std::string client_DIS_Firmware_Str = "12345";
+BLECharacteristic *server_DIS_Hardware_Chr;          // Read
+std::string client_DIS_Hardware_Str = "12345";
+BLECharacteristic *server_DIS_Software_Chr;          // Read
+std::string client_DIS_Software_Str = "12345";
+BLECharacteristic *server_DIS_ManufacturerName_Chr;  // Read
+//std::string client_DIS_Manufacturer_Str = "Adafruit Industries";
+//--------------------------------------------------------------------------------------
+
+/* NORDIC UART SERVICE a.k.a. NUS
+ * NUS Service: 6E400001-B5A3-F393-E0A9-E50E24DCCA9E
+ * NUS RXD    : 6E400002-B5A3-F393-E0A9-E50E24DCCA9E
+ * NUS TXD    : 6E400003-B5A3-F393-E0A9-E50E24DCCA9E
+ */
+BLEUUID UUID_NUS_SERVICE("6E400001-B5A3-F393-E0A9-E50E24DCCA9E");
+BLEUUID UUID_NUS_CHR_RXD("6E400002-B5A3-F393-E0A9-E50E24DCCA9E");
+BLEUUID UUID_NUS_CHR_TXD("6E400003-B5A3-F393-E0A9-E50E24DCCA9E");
+BLEService *server_NordicUart_Service; 
+BLECharacteristic *server_NUS_Rxd_Chr;        // Write No Response (Receiving Data)
+BLECharacteristic *server_NUS_Txd_Chr;        // Read Notify (Sending Data)
+
+/* Cycling Power Service ---------------------------------------------------------------
+ * CP Service: 0x1818  
+ * CP Characteristic: 0x2A63 (Measurement)    Mandatory
+ * CP Characteristic: 0x2A65 (Feature)        Mandatory
+ * CP Characteristic: 0x2A5D (Location)       Optional
+ * CP Characteristic: 0x2A66 (Control Point)  Optional
+ */
+#define UUID16_SVC_CYCLING_POWER                              BLEUUID((uint16_t)0x1818)
+#define UUID16_CHR_CYCLING_POWER_MEASUREMENT                  BLEUUID((uint16_t)0x2A63)
+//#define UUID16_CHR_CYCLING_POWER_VECTOR                       BLEUUID((uint16_t)0x2A64)
+#define UUID16_CHR_CYCLING_POWER_FEATURE                      BLEUUID((uint16_t)0x2A65)
+//#define UUID16_CHR_CYCLING_POWER_CONTROL_POINT                BLEUUID((uint16_t)0x2A66)
+#define UUID16_CHR_SENSOR_LOCATION                            BLEUUID((uint16_t)0x2A5D) // shared with CSC
+BLERemoteService*        pRemote_CyclingPower_Service;
+BLERemoteCharacteristic* pRemote_CP_Measurement_Chr;    // Notify, Read
+BLERemoteCharacteristic* pRemote_CP_Feature_Chr;        // Read
+uint32_t client_CP_Feature_Flags = 0;
+BLERemoteCharacteristic* pRemote_CP_Location_Chr;       // Read
+uint8_t client_CP_Location_Value = {0x0C};                    //          --> rear wheel !
+BLERemoteCharacteristic* pRemote_CP_ControlPoint_Chr;   // Indicate, Write
+bool client_ControlPoint_Response = true;               // CP Write-Response synch test
+// ---------------------------------------------------------------------------------------
+BLEService        *server_CyclingPower_Service;
+BLECharacteristic *server_CP_Measurement_Chr; //                          Notify, Read
+BLECharacteristic *server_CP_Feature_Chr; //                              Read
+BLECharacteristic *server_CP_Location_Chr; //                             Read
+//BLECharacteristic *server_CP_ControlPoint_Chr; //                       Indicate, Write
+// ---------------------------------------------------------------------------------------
+
+const uint8_t client_CP_Feature_Len = 20; // Num. of Feature elements
+const char* client_CP_Feature_Str[client_CP_Feature_Len] = { 
+      "Pedal power balance supported",
+      "Accumulated torque supported",
+      "Wheel revolution data supported",
+      "Crank revolution data supported",
+      "Extreme magnitudes supported",
+      "Extreme angles supported",
+      "Top/bottom dead angle supported",
+      "Accumulated energy supported",
+      "Offset compensation indicator supported",
+      "Offset compensation supported",
+      "Cycling power measurement characteristic content masking supported",
+      "Multiple sensor locations supported",
+      "Crank length adj. supported",
+      "Chain length adj. supported",
+      "Chain weight adj. supported",
+      "Span length adj. supported",
+      "Sensor measurement context",
+      "Instantaineous measurement direction supported",
+      "Factory calibrated date supported",
+      "Enhanced offset compensation supported" };
+
+const uint8_t client_Sensor_Location_Str_Len = 17;       
+const char* client_Sensor_Location_Str[client_Sensor_Location_Str_Len] = { "Other", "Top of shoe", "In shoe", "Hip", 
+    "Front wheel", "Left crank", "Right crank", "Left pedal", "Right pedal", "Front hub", 
+    "Rear dropout", "Chainstay", "Rear wheel", "Rear hub", "Chest", "Spider", "Chain ring"};
+
+/*---------------------------------------------------------------------------------------
+ * Cycling Speed and Cadence Service
+ * CSC Service:   0x1816 
+ * CSC Measurement Characteristic:  0x2A5B
+ * CSC Feature Characteristic:      0x2A5C  
+ */
+#define UUID16_SVC_CYCLING_SPEED_AND_CADENCE                  BLEUUID((uint16_t)0x1816)
+//#define UUID16_CHR_CSC_CONTROL_POINT                          BLEUUID((uint16_t)0x2A55)
+#define UUID16_CHR_CSC_MEASUREMENT                            BLEUUID((uint16_t)0x2A5B)
+#define UUID16_CHR_CSC_FEATURE                                BLEUUID((uint16_t)0x2A5C)
+//#define UUID16_CHR_SENSOR_LOCATION                            BLEUUID((uint16_t)0x2A5D) // shared with CP
+BLERemoteService*        pRemote_CyclingSpeedCadence_Service;
+BLERemoteCharacteristic* pRemote_CSC_Measurement_Chr;         // Notify, Read
+BLERemoteCharacteristic* pRemote_CSC_Feature_Chr;             // Read
+const uint8_t CSC_FEATURE_FIXED_DATALEN = 2; // UINT16
+uint16_t client_CSC_Feature_Flags = 0;
+const uint8_t client_CSC_Feature_Len = 3;
+const char* client_CSC_Feature_Str[client_CSC_Feature_Len] = {"Wheel rev supported", "Crank rev supported", "Multiple locations supported"};
+BLERemoteCharacteristic* pRemote_CSC_Location_Chr;             // Read
+uint8_t client_CSC_Location_Value = {0x0C};                    // Default --> rear wheel !
+// ---------------------------------------------------------------------------------------
+BLEService        *server_CyclingSpeedCadence_Service;  
+BLECharacteristic *server_CSC_Measurement_Chr;               //     Notify, Read
+BLECharacteristic *server_CSC_Feature_Chr;                   //     Read
+BLECharacteristic *server_CSC_Location_Chr;                  //     Read
+// ---------------------------------------------------------------------------------------
+
+/* HRM Service Definitions -------------------------------------------------------------
+ * Heart Rate Monitor Service:  0x180D
+ * Heart Rate Measurement Char: 0x2A37 (Mandatory)
+ * Body Sensor Location Char:   0x2A38 (Optional)
+ */
+#define UUID16_SVC_HEART_RATE             BLEUUID((uint16_t)0x180D)
+#define UUID16_CHR_HEART_RATE_MEASUREMENT BLEUUID((uint16_t)0x2A37)
+#define UUID16_CHR_BODY_SENSOR_LOCATION   BLEUUID((uint16_t)0x2A38)
+BLERemoteService* pRemote_HeartRate_Service;
+BLERemoteCharacteristic* pRemote_HR_Measurement_Chr;
+BLERemoteCharacteristic* pRemote_HR_Location_Chr;
+/*  HR Body Sensor Location
+    0x00 Other
+    0x01 Chest
+    0x02 Wrist
+    0x03 Finger
+    0x04 Hand
+    0x05 Ear Lobe
+    0x06 Foot
+    0x07–0xFF Reserved for Future Use
+*/
+uint8_t client_HR_Location_Value= { 0x01 }; // Chest
+// --------------------------------------------------------------------------------------
+BLEService *server_HeartRate_Service;
+BLECharacteristic *server_HR_Measurement_Chr;  // Notify Write
+BLECharacteristic *server_HR_Location_Chr;     // Read
+// --------------------------------------------------------------------------------------
+
+/* --------------------------------------------------------------------------------------
+ * Fitness Machine Service, uuid 0x1826 or 00001826-0000-1000-8000-00805F9B34FB
+*/
+#define UUID16_SVC_FITNESS_MACHINE                            BLEUUID((uint16_t)0x1826)
+#define UUID16_CHR_FITNESS_MACHINE_FEATURE                    BLEUUID((uint16_t)0x2ACC)
+#define UUID16_CHR_INDOOR_BIKE_DATA                           BLEUUID((uint16_t)0x2AD2)
+#define UUID16_CHR_TRAINING_STATUS                            BLEUUID((uint16_t)0x2AD3)
+//#define UUID16_CHR_SUPPORTED_SPEED_RANGE                      BLEUUID((uint16_t)0x2AD4)
+//#define UUID16_CHR_SUPPORTED_INCLINATION_RANGE                BLEUUID((uint16_t)0x2AD5)
+#define UUID16_CHR_SUPPORTED_RESISTANCE_LEVEL_RANGE           BLEUUID((uint16_t)0x2AD6)
+//#define UUID16_CHR_SUPPORTED_HEART_RATE_RANGE                 BLEUUID((uint16_t)0x2AD7)
+#define UUID16_CHR_SUPPORTED_POWER_RANGE                      BLEUUID((uint16_t)0x2AD8)
+#define UUID16_CHR_FITNESS_MACHINE_CONTROL_POINT              BLEUUID((uint16_t)0x2AD9)
+#define UUID16_CHR_FITNESS_MACHINE_STATUS                     BLEUUID((uint16_t)0x2ADA)
+BLERemoteService* pRemote_FitnessMachine_Service; // FTM Service
+// Service characteristics exposed by FTM Service
+BLERemoteCharacteristic* pRemote_FTM_SupportedResistanceLevelRange_Chr; // Supported Resistance Level, read, optional
+//const uint8_t FTM_SRLR_FIXED_DATALEN = 6;
+std::string client_FTM_SupportedResistanceLevelRange_Str;
+BLERemoteCharacteristic* pRemote_FTM_SupportedPowerRange_Chr;  // Supported Power Levels, read, optional
+//const uint8_t FTM_SPR_FIXED_DATALEN = 6;
+std::string client_FTM_SupportedPowerRange_Str;
+BLERemoteCharacteristic* pRemote_FTM_Feature_Chr; //  Fitness Machine Feature, mandatory, read
+//const uint8_t FTM_FEATURE_FIXED_DATALEN = 8;
+std::string client_FTM_Feature_Str;
+BLERemoteCharacteristic* pRemote_FTM_TrainingStatus_Chr; //  Training Status, optional, read & notify
+BLERemoteCharacteristic* pRemote_FTM_Status_Chr; //  Fitness Machine Status, mandatory, notify
+BLERemoteCharacteristic* pRemote_FTM_IndoorBikeData_Chr; //  Indoor Bike Data, optional, notify
+BLERemoteCharacteristic* pRemote_FTM_ControlPoint_Chr; //  Fitness Machine Control Point, optional, write & indicate
+// ---------------------------------------------------------------------------------------
+BLEService        *server_FitnessMachine_Service; // FTM Service
+BLECharacteristic *server_FTM_Feature_Chr; //  Fitness Machine Feature, mandatory, read
+BLECharacteristic *server_FTM_Status_Chr; //  Fitness Machine Status, mandatory, notify
+BLECharacteristic *server_FTM_IndoorBikeData_Chr;  //  Indoor Bike Data, optional, notify
+BLECharacteristic *server_FTM_ControlPoint_Chr; //  Fitness Machine Control Point, optional, write & indicate
+BLECharacteristic *server_FTM_TrainingStatus_Chr; //  Training Status, optional, read & notify
+BLECharacteristic *server_FTM_SupportedResistanceLevelRange_Chr; // Supported Resistance Level, read, optional
+BLECharacteristic *server_FTM_SupportedPowerRange_Chr; // Supported Power Levels, read, optional
+// ---------------------------------------------------------------------------------------
+/**
+ * Fitness Machine Control Point opcodes 
+ * 
+ * LSO: uint8 Op Code
+ * MSO: 0..18 octets Parameters
+ */
+const uint8_t ftmcpRequestControl = 0x00;
+const uint8_t ftmcpReset = 0x01;
+const uint8_t ftmcpSetTargetSpeed = 0x02;
+const uint8_t ftmcpSetTargetInclination = 0x03;
+const uint8_t ftmcpSetTargetResistanceLevel = 0x04;
+const uint8_t ftmcpSetTargetPower = 0x05;
+const uint8_t ftmcpSetTargetHeartRate = 0x06;
+const uint8_t ftmcpStartOrResume = 0x07;
+const uint8_t ftmcpStopOrPause = 0x08;
+const uint8_t ftmcpSetTargetedExpendedEngery = 0x09;
+const uint8_t ftmcpSetTargetedNumberOfSteps = 0x0A;
+const uint8_t ftmcpSetTargetedNumberOfStrided = 0x0B;
+const uint8_t ftmcpSetTargetedDistance = 0x0C;
+const uint8_t ftmcpSetTargetedTrainingTime = 0x0D;
+const uint8_t ftmcpSetTargetedTimeInTwoHeartRateZones = 0x0E;
+const uint8_t ftmcpSetTargetedTimeInThreeHeartRateZones = 0x0F;
+const uint8_t ftmcpSetTargetedTimeInFiveHeartRateZones = 0x10;
+const uint8_t ftmcpSetIndoorBikeSimulationParameters = 0x11;
+const uint8_t ftmcpSetWheelCircumference = 0x12;
+const uint8_t ftmcpSetSpinDownControl = 0x13;
+const uint8_t ftmcpSetTargetedCadence = 0x14;
+
+/** 
+ * The Fitness Machine Control Point data type structure 
+ * 
+ */
+const uint8_t FTM_CONTROL_POINT_DATALEN = 19; // Control point consists of 1 opcode (byte) and maximum 18 bytes as parameters
+// This ftmcp_data_t structure represents the control point data. The first octet represents the opcode of the request
+// followed by a parameter array of maximum 18 octects
+typedef struct __attribute__( ( packed ) )
+{
+  uint8_t OPCODE;
+  uint8_t OCTETS[(FTM_CONTROL_POINT_DATALEN-1)];
+} ftmcp_data_t;
+
+typedef union // The union type automatically maps the bytes member array to the ftmcp_data_t structure member values
+{
+  ftmcp_data_t values;
+  uint8_t bytes[FTM_CONTROL_POINT_DATALEN];
+} ftmcp_data_ut;
+
+// Fitness Machine Control Point Data variable
+ftmcp_data_ut server_FTM_Control_Point_Data;
+
+// ----------------------xControlPointWriter task definitions ---------------------
+// Control Point writes of the app are queued as fixed size frames and written (with response)
+// to the trainer by one long-lived task --> no task creation and stack allocation per command
+#define CONTROL_POINT_QUEUE_LENGTH 8
+typedef struct {
+  uint8_t Length;
+  uint8_t Data[FTM_CONTROL_POINT_DATALEN];
+  unsigned long EnqueueTime;  // micros() at receipt of the app's write
+} ftmcp_frame_t;
+QueueHandle_t xControlPointQueue = NULL;
+TaskHandle_t ControlPointWriterHandle = NULL;
+void xControlPointWriter(void *parameter);
+// Latency histograms of the hops from the app to the trainer
+#include <LatencyHistogram.h>
+LatencyHistogram ControlPointQueueLatency;  // Server onWrite -> client writeValue (queued, coalesced, retried)
+LatencyHistogram ControlPointWriteLatency;  // Client writeValue with response -> trainer's write response
+LatencyHistogram ControlPointAckLatency;    // Server onWrite -> trainer's Control Point indication
+unsigned long ControlPointInFlightTime = 0;  // EnqueueTime of the command waiting for its ack, 0 -> none
+unsigned long ControlPointQueueFull = 0;
+// The newest pending command per opcode is kept and sent as soon as the trainer has acknowledged the previous one
+#define CONTROL_POINT_PENDING_SLOTS (ftmcpSetTargetedCadence+2) // One slot per opcode, the last one for any other opcode
+#define CONTROL_POINT_WRITER_WAIT 1000 // ms, maximal wait time for a new command or an ack
+ftmcp_frame_t ControlPointPending[CONTROL_POINT_PENDING_SLOTS];
+unsigned long ControlPointPendingSeq[CONTROL_POINT_PENDING_SLOTS] = {0}; // Arrival order, 0 -> slot is empty
+unsigned long ControlPointSeq = 0;
+unsigned long ControlPointCoalesced = 0;  // Stale commands that were overwritten by a newer one
+// A failed write or a missing ack (trainer's indication) is retried after a jittered delay,
+// only after consecutive failures the trainer is disconnected (--> reconnect and rediscovery)
+#define CONTROL_POINT_ACK_TIMEOUT     500  // ms, maximal wait for the trainer's indication after a write
+#define CONTROL_POINT_RETRY_DELAY     100  // ms, retry delay is a multiple of the consecutive failures
+#define CONTROL_POINT_RETRY_JITTER     50  // ms, random extra retry delay
+#define CONTROL_POINT_MAX_FAILURES      3  // Consecutive failures before escalation to disconnect
+enum { CP_IDLE, CP_AWAIT_ACK, CP_RETRY_WAIT };
+uint8_t ControlPointState = CP_IDLE;
+uint8_t ControlPointFailures = 0;         // Consecutive failures
+unsigned long ControlPointDeadline = 0;   // millis() when the ack wait or retry delay expires
+ftmcp_frame_t ControlPointInFlight;       // Copy of the command that was sent last
+unsigned long ControlPointInFlightSeq = 0;
+// Counters per outcome for diagnostics
+unsigned long ControlPointWrites = 0;
+unsigned long ControlPointWriteErrors = 0;
+unsigned long ControlPointAckTimeouts = 0;
+unsigned long ControlPointRetries = 0;
+unsigned long ControlPointEscalations = 0;
+
+// ----------------------xNotifyForwarder task definitions ------------------------
+// Client notifications of the trainer are pushed in a lock-free ring per characteristic and forwarded
+// to the app by one task --> a slow or congested app link does not back-pressure the trainer link
+#include <PacketRing.h>
+// Downstream rate limit per forwarded characteristic: the app needs samples at a few Hz only
+#define RATE_CP_MEASUREMENT_MS      250  // ms between notifications, 0 -> every sample
+#define RATE_CSC_MEASUREMENT_MS     250
+#define RATE_HR_MEASUREMENT_MS     1000
+#define RATE_FTM_INDOORBIKEDATA_MS  250
+// Forward policies: events pass through, samples are rate limited (newest sample or its fields averaged over the window)
+enum { FORWARD_PASS_THROUGH, FORWARD_LATEST, FORWARD_AVERAGE };
+enum { AVERAGE_POWER, AVERAGE_CADENCE, AVERAGE_FIELDS };
+enum { FORWARD_CP_MEASUREMENT, FORWARD_CSC_MEASUREMENT, FORWARD_HR_MEASUREMENT, FORWARD_FTM_INDOORBIKEDATA,
+       FORWARD_FTM_TRAININGSTATUS, FORWARD_FTM_STATUS, FORWARD_COUNT };
+typedef struct {
+  const char *Name;
+  BLECharacteristic **Chr;  // Server characteristic that is notified to the app
+  BLERemoteCharacteristic **Source; // Client characteristic of the trainer
+  uint8_t Policy;
+  uint16_t MinInterval;     // ms between notifications of a rate limited channel
+  PacketRing Ring;
+  LatencyHistogram Latency; // Client notify callback -> server notify
+  // Aggregation state of a rate limited channel, updated in O(1) per sample
+  ring_packet_t Pending;    // Newest sample, not yet forwarded
+  bool IsPending;
+  int32_t Sum[AVERAGE_FIELDS];      // Running sums of the averaged fields
+  uint16_t Samples[AVERAGE_FIELDS];
+  unsigned long LastSent;   // millis() of the last notification
+  unsigned long Saved;      // Samples merged into a later notification instead of notified
+  unsigned long AirtimeSaved; // Estimated us on air per central
+} forward_channel_t;
+forward_channel_t ForwardChannels[FORWARD_COUNT] = {
+  {"CP Measurement",      &server_CP_Measurement_Chr,     &pRemote_CP_Measurement_Chr,     FORWARD_AVERAGE,      RATE_CP_MEASUREMENT_MS     },
+  {"CSC Measurement",     &server_CSC_Measurement_Chr,    &pRemote_CSC_Measurement_Chr,    FORWARD_LATEST,       RATE_CSC_MEASUREMENT_MS    }, // Cumulative values
+  {"HR Measurement",      &server_HR_Measurement_Chr,     &pRemote_HR_Measurement_Chr,     FORWARD_LATEST,       RATE_HR_MEASUREMENT_MS     },
+  {"FTM Indoor Bike Data",&server_FTM_IndoorBikeData_Chr, &pRemote_FTM_IndoorBikeData_Chr, FORWARD_AVERAGE,      RATE_FTM_INDOORBIKEDATA_MS },
+  {"FTM Training Status", &server_FTM_TrainingStatus_Chr, &pRemote_FTM_TrainingStatus_Chr, FORWARD_PASS_THROUGH, 0}, // Events: forward all
+  {"FTM Status",          &server_FTM_Status_Chr,         &pRemote_FTM_Status_Chr,         FORWARD_PASS_THROUGH, 0}  // Events: forward all
+};
+TaskHandle_t NotifyForwarderHandle = NULL;
+// Subscription table: every connected central with its CCCD state per forwarded characteristic,
+// notifications fan out to all subscribed centrals, each with its own flow control (credits)
+#define MAX_CENTRALS CONFIG_BT_NIMBLE_MAX_CONNECTIONS
+#define CENTRAL_PACKETS_PER_EVENT 4  // Credits a central gets per connection event
+#define CENTRAL_MAX_CREDITS       8  // Maximal burst of notifications to one central
+typedef struct {
+  uint16_t conn_handle;       // BLE_HS_CONN_HANDLE_NONE -> free entry
+  uint8_t Subscribed;         // Bit per forward channel: notify enabled in the CCCD
+  uint16_t Interval;          // Connection interval in 1.25 ms units
+  uint16_t MTU;
+  uint8_t Credits;
+  unsigned long CreditTime;   // micros() of the last credit refill
+  unsigned long Sent;
+  unsigned long Dropped;      // No credits left (slow central) or no mbuf available
+  unsigned long Oversize;     // Packet does not fit in the MTU of this central
+} central_sub_t;
+central_sub_t Centrals[MAX_CENTRALS];
+SemaphoreHandle_t xCentralMutex = NULL;
+volatile uint8_t SubscribedChannels = 0; // Channels with at least one subscribed central
+// The trainer's data is needed: the Laptop (Zwift) subscribes right after connecting, others only when subscribed
+#define IS_TRAINER_DATA_WANTED (Laptop.IsConnected || (SubscribedChannels != 0))
+void AddCentral(uint16_t conn_handle, uint16_t Interval);
+void RemoveCentral(uint16_t conn_handle);
+void SetCentralSubscription(uint16_t conn_handle, NimBLECharacteristic* pCharacteristic, uint16_t subValue);
+void RefreshCentrals(void);
+#ifdef DEBUG_NOTIFY_FORWARDING
+unsigned long ForwardMicrosSum = 0;  // CPU time spent in notify per forwarded packet
+unsigned long ForwardMicrosMax = 0;
+unsigned long ForwardPackets = 0;
+#endif
+void xNotifyForwarder(void *parameter);
+void ForwardNotification(uint8_t Channel, const uint8_t *pData, size_t length);
+// All latency histograms of the bridge, per direction and characteristic
+typedef struct {
+  const char *Tag;   // Short name for NUS
+  const char *Name;
+  LatencyHistogram *Histogram;
+} latency_probe_t;
+const uint8_t LATENCY_PROBES = 9;
+latency_probe_t LatencyProbes[LATENCY_PROBES] = {
+  {"CPQ", "App->Trainer CP queue",        &ControlPointQueueLatency},
+  {"CPW", "App->Trainer CP write",        &ControlPointWriteLatency},
+  {"CPA", "App->Trainer CP ack",          &ControlPointAckLatency},
+  {"CP",  "Trainer->App CP Measurement",  &ForwardChannels[FORWARD_CP_MEASUREMENT].Latency},
+  {"CSC", "Trainer->App CSC Measurement", &ForwardChannels[FORWARD_CSC_MEASUREMENT].Latency},
+  {"HR",  "Trainer->App HR Measurement",  &ForwardChannels[FORWARD_HR_MEASUREMENT].Latency},
+  {"IBD", "Trainer->App Indoor Bike Data",&ForwardChannels[FORWARD_FTM_INDOORBIKEDATA].Latency},
+  {"TS",  "Trainer->App Training Status", &ForwardChannels[FORWARD_FTM_TRAININGSTATUS].Latency},
+  {"ST",  "Trainer->App Machine Status",  &ForwardChannels[FORWARD_FTM_STATUS].Latency}
+};
+
+// Global variables for decoding of Control Point: INDOOR BIKE DATA RESISTANCE PARAMETERS
+float wind_speed = 0;       // meters per second, resolution 0.001
+float grade = 0;            // percentage, resolution 0.01
+float crr = 0;              // Coefficient of rolling resistance, resolution 0.0001
+float cw = 0;               // Wind resistance Kg/m, resolution 0.01;
+// ----------------------------------------------------------------------------------------------
+
+#ifdef DEBUG
+// ---------------------Fitness Machine Features (bytes 1-4):
+const uint8_t client_FTM_Feature_Str_One_Len = 32;
+const char* client_FTM_Feature_Str_One[client_FTM_Feature_Str_One_Len] = {
+"Average Speed Supported", "Cadence Supported", "Total Distance Supported", "Inclination Supported",
+"Elevation Gain Supported", "Pace Supported", "Step Count Supported", "Resistance Level Supported",
+"Stride Count Supported", "Expended Energy Supported", "Heart Rate Measurement Supported", "Metabolic Equivalent Supported",
+"Elapsed Time Supported", "Remaining Time Supported", "Power Measurement Supported", "Force on Belt and Power Output Supported",
+"User Data Retention Supported", "Reserved for Future Use","","","","","","","","","","","","","",""};
+// ---------------------Fitness Machine Target Setting Features (bytes 5-8) :
+const uint8_t client_FTM_Feature_Str_Two_Len = 32;
+const char* client_FTM_Feature_Str_Two[client_FTM_Feature_Str_Two_Len] = {
+"Speed Target Setting Supported", "Inclination Target Setting Supported", "Resistance Target Setting Supported", "Power Target Setting Supported",
+"Heart Rate Target Setting Supported", "Targeted Expended Energy Configuration Supported", "Targeted Step Number Configuration Supported",
+"Targeted Stride Number Configuration Supported", "Targeted Distance Configuration Supported", "Targeted Training Time Configuration Supported",
+"Targeted Time in Two Heart Rate Zones Configuration Supported", "Targeted Time in Three Heart Rate Zones Configuration Supported",
+"Targeted Time in Five Heart Rate Zones Configuration Supported", "Indoor Bike Simulation Parameters Supported", "Wheel Circumference Configuration Supported",
+"Spin Down Control Supported", "Targeted Cadence Configuration Supported", "Reserved for Future Use","","","","","","","","","","","","","",""};
+#endif
+
+// --------------------------------------------------------------------------------------
+BLEClient* pClient_FTMS = nullptr;
+BLEAdvertisedDevice* myDevice = nullptr;
+BLEScan* pBLEScan = nullptr;
+BLEServer* pServer = nullptr;
+// Direct connect to the remembered trainer (address and type in TRAINER_FILENAME), scanning is the fallback
+#define TRAINER_FILENAME "/trainer.txt"
+#define DIRECT_CONNECT_TIMEOUT 3  // seconds, the trainer should be advertising when it is switched on
+#define SCAN_CONNECT_TIMEOUT  30  // seconds, NimBLE default
+const uint8_t TrainerPlaceholder[6] = {0x05,0x04,0x03,0x02,0x01,0x00}; // TRAINERADDRESS left unchanged
+const uint8_t TrainerConfigured[6] = TRAINERADDRESS;
+#define IS_ANY_TRAINER (memcmp(TrainerConfigured, TrainerPlaceholder, 6) == 0) // Else only the configured trainer
+uint8_t TrainerAddressType = BLE_ADDR_PUBLIC;
+bool IsTrainerRemembered = false;
+bool IsDirectConnect = false;        // Current connect attempt is direct (true) or after a scan (false)
+unsigned long TrainerSearchTime = 0; // millis() at the start of the direct connect or scan, for time-to-connected
+bool client_Direct_Connect(void);
+// Recovery: every attempt is a direct connect plus a bounded scan window, with exponential backoff in between
+#define RECOVER_SCAN_WINDOW  10     // seconds of scanning per attempt
+#define RECOVER_BACKOFF_MIN  2000   // ms, pause after the first failed attempt, doubled after every next one
+#define RECOVER_BACKOFF_MAX  60000  // ms, the scan duty cycle is at least 10 s in every 70 s
+unsigned long RecoverBackoff = RECOVER_BACKOFF_MIN;
+unsigned long RecoverNextTime = 0;    // millis() of the next attempt, 0 -> none pending
+unsigned long RecoverStartTime = 0;   // millis() when the trainer was lost (or boot), for time-to-recover
+unsigned long RecoverAttempts = 0;    // Of the current recovery, 0 -> trainer is connected
+unsigned long LastRecoverDuration = 0;
+volatile bool IsTrainerFound = false; // Set by the scan callback before it stops the scan
+void client_Scan_Ended(NimBLEScanResults Results);
+void client_Backoff(void);
+// Scan stage: FTMS trainers are collected for a short window after the first one is seen and ranked,
+// the remembered (or configured) trainer ends the scan stage immediately
+#define SCAN_RANK_WINDOW     1500  // ms after the first candidate
+#define SCAN_REMEMBERED_ATTEMPTS 3 // Full scan windows of searching for the remembered trainer before a ranked pick
+#define SCAN_MAX_CANDIDATES  8
+#define SCAN_MIN_RSSI        -90   // dBm, weaker trainers are in another room
+// Scan interval and window in ms: aggressive in the first attempt of a (re)connect, duty-cycled in the next ones
+#define SCAN_FAST_INTERVAL   100
+#define SCAN_FAST_WINDOW     100   // 100% duty cycle
+#define SCAN_SLOW_INTERVAL   1349
+#define SCAN_SLOW_WINDOW     449   // 33% duty cycle
+#define SCAN_HAS_FTMS        (1 << 0)
+#define SCAN_HAS_CP          (1 << 1)
+#define SCAN_HAS_CSC         (1 << 2)
+typedef struct {
+  uint8_t Address[6];
+  uint8_t AddressType;
+  int8_t RSSI;          // Of the last advertisement
+  uint8_t Services;     // SCAN_HAS_* bits
+  char Name[32];
+} scan_candidate_t;
+scan_candidate_t ScanCandidates[SCAN_MAX_CANDIDATES];
+volatile uint8_t ScanCandidateCount = 0;     // Changed under ScanCandidateMux only
+volatile unsigned long ScanRankStartTime = 0; // millis() of the first candidate
+// The host task adds candidates while loop() takes them: both access the table in a critical section
+portMUX_TYPE ScanCandidateMux = portMUX_INITIALIZER_UNLOCKED;
+// Trainer before the selected candidate: it is tried again when the candidate fails to connect
+uint8_t PreviousTrainerAddress[6];
+uint8_t PreviousTrainerAddressType;
+std::string PreviousTrainerName;
+bool IsRankedPick = false; // Trainer is a ranked candidate: it does not replace the remembered trainer in TRAINER_FILENAME
+void client_Add_Candidate(BLEAdvertisedDevice* advertisedDevice);
+void client_Select_Candidate(void);
+void client_Restore_Trainer(void);
+NimBLEAdvertising *pAdvertising = nullptr;
+// Advertising policy: fast for ADV_FAST_PERIOD after boot or a disconnect (the app finds the Simcline quickly),
+// slow after that (less airtime next to the trainer link). Intervals in 0.625 ms units
+#define ADV_FAST_PERIOD        30000 // ms
+#define ADV_FAST_MIN_INTERVAL  32    // 20 ms
+#define ADV_FAST_MAX_INTERVAL  48    // 30 ms
+#define ADV_SLOW_MIN_INTERVAL  244   // 152.5 ms
+#define ADV_SLOW_MAX_INTERVAL  338   // 211.25 ms
+bool IsAdvertisingFast = false;
+unsigned long AdvertisingStartTime = 0;  // millis() of the start of the fast phase
+unsigned long LastDiscoveryTime = 0;     // ms from the start of advertising to the connect of the last app
+void server_Start_Advertising(bool IsFast);
+
+// Connection parameter policy per link: fast while Control Point commands flow, relaxed when idle
+// Units: intervals in 1.25 ms, latency in connection events to skip, supervision timeout in 10 ms
+#include <LinkPolicy.h>
+#define LINK_IDLE_AFTER 5000 // ms without Control Point traffic before a link is relaxed
+const conn_params_t TrainerActiveParams = {12, 24, 0, 400}; // 15-30 ms
+const conn_params_t TrainerIdleParams   = {40, 80, 0, 400}; // 50-100 ms, data is sent at 1-4 Hz
+const conn_params_t AppActiveParams     = {12, 24, 0, 400}; // 15-30 ms
+const conn_params_t AppIdleParams       = {24, 48, 4, 400}; // 30-60 ms, Simcline may skip 4 events when idle
+LinkPolicy TrainerLink;
+LinkPolicy AppLink;
+void ApplyLinkPolicy(LinkPolicy *Link);
+
+// GATT handle cache: value/CCCD handles and static values of the trainer are persisted per trainer address (LittleFS),
+// at reconnect the cache is validated with the trainer's Database Hash and used instead of a full discovery
+#include <GattCache.h>
+#define GATT_REQUEST_TIMEOUT 2000 // ms, max wait for the response of a single ATT request
+typedef void (*client_notify_t)(BLERemoteCharacteristic*, uint8_t*, size_t, bool);
+void client_CP_Measurement_Notify_Callback(BLERemoteCharacteristic* pBLERemoteCharacteristic, uint8_t* pData, size_t length, bool isNotify);
+void client_CSC_Measurement_Notify_Callback(BLERemoteCharacteristic* pBLERemoteCharacteristic, uint8_t* pData, size_t length, bool isNotify);
+void client_HR_Measurement_Notify_Callback(BLERemoteCharacteristic* pBLERemoteCharacteristic, uint8_t* pData, size_t length, bool isNotify);
+void client_FTM_IndoorBikeData_Notify_Callback(BLERemoteCharacteristic* pBLERemoteCharacteristic, uint8_t* pData, size_t length, bool isNotify);
+void client_FTM_TrainingStatus_Notify_Callback(BLERemoteCharacteristic* pBLERemoteCharacteristic, uint8_t* pData, size_t length, bool isNotify);
+void client_FTM_ControlPoint_Indicate_Callback(BLERemoteCharacteristic* pBLERemoteCharacteristic, uint8_t* pData, size_t length, bool isNotify);
+void client_FTM_Status_Notify_Callback(BLERemoteCharacteristic* pBLERemoteCharacteristic, uint8_t* pData, size_t length, bool isNotify);
+typedef struct {
+  BLEUUID Service;
+  BLEUUID Characteristic;
+  BLERemoteCharacteristic **Chr; // Set by a full discovery only
+  client_notify_t Callback;      // NULL -> static value, read once and cached
+  bool IsIndicate;
+  uint16_t ValueHandle;          // Handles of the current connection
+  uint16_t CCCDHandle;
+} client_chr_t;
+// All used characteristics of the trainer
+client_chr_t ClientCharacteristics[] = {
+  {UUID16_SVC_GENERIC_ACCESS,             UUID16_CHR_DEVICE_NAME,                      &pRemote_GA_DeviceName_Chr,        NULL, false},
+  {UUID16_SVC_GENERIC_ACCESS,             UUID16_CHR_APPEARANCE,                       &pRemote_GA_Appearance_Chr,        NULL, false},
+  {UUID16_SVC_DEVICE_INFORMATION,         UUID16_CHR_MANUFACTURER_NAME_STRING,         &pRemote_DIS_ManufacturerName_Chr, NULL, false},
+  {UUID16_SVC_DEVICE_INFORMATION,         UUID16_CHR_MODEL_NUMBER_STRING,              &pRemote_DIS_ModelNumber_Chr,      NULL, false},
+  {UUID16_SVC_DEVICE_INFORMATION,         UUID16_CHR_SERIAL_NUMBER_STRING,             &pRemote_DIS_SerialNumber_Chr,     NULL, false},
+  {UUID16_SVC_CYCLING_POWER,              UUID16_CHR_CYCLING_POWER_MEASUREMENT,        &pRemote_CP_Measurement_Chr,       client_CP_Measurement_Notify_Callback, false},
+  {UUID16_SVC_CYCLING_POWER,              UUID16_CHR_CYCLING_POWER_FEATURE,            &pRemote_CP_Feature_Chr,           NULL, false},
+  {UUID16_SVC_CYCLING_POWER,              UUID16_CHR_SENSOR_LOCATION,                  &pRemote_CP_Location_Chr,          NULL, false},
+  {UUID16_SVC_CYCLING_SPEED_AND_CADENCE,  UUID16_CHR_CSC_MEASUREMENT,                  &pRemote_CSC_Measurement_Chr,      client_CSC_Measurement_Notify_Callback, false},
+  {UUID16_SVC_CYCLING_SPEED_AND_CADENCE,  UUID16_CHR_CSC_FEATURE,                      &pRemote_CSC_Feature_Chr,          NULL, false},
+  {UUID16_SVC_CYCLING_SPEED_AND_CADENCE,  UUID16_CHR_SENSOR_LOCATION,                  &pRemote_CSC_Location_Chr,         NULL, false},
+  {UUID16_SVC_HEART_RATE,                 UUID16_CHR_HEART_RATE_MEASUREMENT,           &pRemote_HR_Measurement_Chr,       client_HR_Measurement_Notify_Callback, false},
+  {UUID16_SVC_HEART_RATE,                 UUID16_CHR_BODY_SENSOR_LOCATION,             &pRemote_HR_Location_Chr,          NULL, false},
+  {UUID16_SVC_FITNESS_MACHINE,            UUID16_CHR_FITNESS_MACHINE_FEATURE,          &pRemote_FTM_Feature_Chr,          NULL, false},
+  {UUID16_SVC_FITNESS_MACHINE,            UUID16_CHR_INDOOR_BIKE_DATA,                 &pRemote_FTM_IndoorBikeData_Chr,   client_FTM_IndoorBikeData_Notify_Callback, false},
+  {UUID16_SVC_FITNESS_MACHINE,            UUID16_CHR_TRAINING_STATUS,                  &pRemote_FTM_TrainingStatus_Chr,   client_FTM_TrainingStatus_Notify_Callback, false},
+  {UUID16_SVC_FITNESS_MACHINE,            UUID16_CHR_SUPPORTED_RESISTANCE_LEVEL_RANGE, &pRemote_FTM_SupportedResistanceLevelRange_Chr, NULL, false},
+  {UUID16_SVC_FITNESS_MACHINE,            UUID16_CHR_SUPPORTED_POWER_RANGE,            &pRemote_FTM_SupportedPowerRange_Chr, NULL, false},
+  {UUID16_SVC_FITNESS_MACHINE,            UUID16_CHR_FITNESS_MACHINE_CONTROL_POINT,    &pRemote_FTM_ControlPoint_Chr,     client_FTM_ControlPoint_Indicate_Callback, true},
+  {UUID16_SVC_FITNESS_MACHINE,            UUID16_CHR_FITNESS_MACHINE_STATUS,           &pRemote_FTM_Status_Chr,           client_FTM_Status_Notify_Callback, false}
+};
+#define CLIENT_CHR_COUNT (sizeof(ClientCharacteristics)/sizeof(client_chr_t))
+GattCache TrainerGattCache;
+volatile bool IsHandleRouting = false; // Trainer notifications are routed by value handle (NimBLE has no subscriptions)
+struct ble_gap_event_listener GattCacheListener;
+// Synchronous ATT requests on the trainer link, one at a time
+SemaphoreHandle_t xGattRequestMutex = NULL;
+SemaphoreHandle_t xGattRequestDone = NULL;
+volatile uint32_t GattRequestSeq = 0;    // Responses of a timed out request are ignored
+volatile int GattRequestStatus = 0;
+uint8_t *GattRequestData = NULL;
+uint16_t GattRequestSize = 0;
+volatile uint16_t GattRequestLength = 0;
+int client_GattCache_Event(struct ble_gap_event *event, void *arg);
+// CCCD writes are pipelined: the next one is sent from the response callback of the previous one,
+// a failed write is retried individually
+#define CCCD_WRITE_RETRIES 2     // Per CCCD
+#define CCCD_ALL_TIMEOUT   5000  // ms, max time to write all CCCD's
+SemaphoreHandle_t xCCCDDone = NULL;
+volatile uint32_t CCCDSeq = 0;   // Responses of a timed out run are ignored
+volatile uint8_t CCCDIndex = 0;  // Entry of ClientCharacteristics[] in progress
+volatile uint8_t CCCDRetries = 0;
+volatile uint8_t CCCDWrites = 0;
+volatile uint8_t CCCDFailures = 0;
+bool CCCDEnable = false;
+bool CCCDOptionalOnly = false;   // Only the CCCD's of the optional services
+bool IsGattCacheUnverified = false; // Connected from the GATT cache, no CCCD has been written yet
+// Time from app connect to notifications flowing on all subscribed sample channels
+unsigned long AppConnectTime = 0;
+volatile bool IsFlowPending = false;
+uint8_t FlowSeenChannels = 0;
+bool client_Set_All_NotificationIndication(bool IsEnable);
+bool client_Set_NotificationIndication(bool IsEnable, bool IsOptionalOnly);
+int client_CCCD_Callback(uint16_t conn_handle, const struct ble_gatt_error *error, struct ble_gatt_attr *attr, void *arg);
+int client_Write_Handle(uint16_t Handle, const uint8_t *Data, uint16_t Length);
+client_chr_t *FindClientCharacteristic(BLERemoteCharacteristic **Chr);
+// Prioritised discovery: the critical phase (FTMS and CP) makes the trainer ready for riding, the optional services
+// and their read-only values (HR, CSC, DIS, Generic Access) are discovered by loop() in the background afterwards
+bool client_HeartRate_Connect(void);
+bool client_CyclingSpeedCadence_Connect(void);
+bool client_DeviceInformation_Connect(void);
+bool client_GenericAccess_Connect(void);
+typedef struct {
+  BLEUUID Service;
+  bool (*Discover)(void);
+} client_optional_t;
+const client_optional_t OptionalServices[] = {
+  {UUID16_SVC_HEART_RATE,                 client_HeartRate_Connect},
+  {UUID16_SVC_CYCLING_SPEED_AND_CADENCE,  client_CyclingSpeedCadence_Connect},
+  {UUID16_SVC_DEVICE_INFORMATION,         client_DeviceInformation_Connect},
+  {UUID16_SVC_GENERIC_ACCESS,             client_GenericAccess_Connect}
+};
+#define OPTIONAL_SERVICE_COUNT (sizeof(OptionalServices)/sizeof(client_optional_t))
+uint8_t OptionalStep = OPTIONAL_SERVICE_COUNT; // Next optional service to discover, COUNT -> none pending
+unsigned long OptionalStartTime = 0;
+bool client_Is_Critical(const client_chr_t *C);
+void client_Discover_Optional(void);
+
+// Connection state machine: BLE callbacks post events, loop() blocks on the event group and handles them immediately
+#include "freertos/event_groups.h"
+#define EVT_TRAINER_FOUND   (1 << 0)  // Scan found the trainer: connect() is not allowed in the scan callback
+#define EVT_TRAINER_LOST    (1 << 1)  // Trainer disconnected
+#define EVT_CLIENT_ENABLE   (1 << 2)  // A central needs the trainer's data: enable Notify/Indicate
+#define EVT_CLIENT_DISABLE  (1 << 3)  // No central needs the trainer's data anymore
+#define EVT_SCAN_ENDED      (1 << 4)  // Scan window has ended without finding the trainer
+#define EVT_ALL (EVT_TRAINER_FOUND | EVT_TRAINER_LOST | EVT_CLIENT_ENABLE | EVT_CLIENT_DISABLE | EVT_SCAN_ENDED)
+#define LOOP_PERIOD 200 // ms, max wait for an event, periodic work (link policy, centrals) is done in between
+EventGroupHandle_t xConnectionEvents = NULL;
+enum { CONN_SCAN, CONN_CONNECT, CONN_DISCOVER, CONN_SUBSCRIBE, CONN_READY, CONN_RECOVER, CONN_STATES };
+const char *ConnectionStateName[CONN_STATES] = { "Scan", "Connect", "Discover", "Subscribe", "Ready", "Recover" };
+volatile uint8_t ConnectionState = CONN_SCAN;
+unsigned long ConnectionStateTime = 0;                    // millis() of the last transition
+unsigned long ConnectionStateDuration[CONN_STATES] = {};  // ms in each state, the last time it was left
+unsigned long ConnectionTransitions = 0;
+void SetConnectionState(uint8_t State);
+void client_Recover(void);
+
+// Values used to enable or disable notifications/indications
+const uint8_t notificationOff[] = {0x0, 0x0};
+const uint8_t notificationOn[] = {0x1, 0x0};
+const uint8_t indicationOff[] = {0x0, 0x0};
+const uint8_t indicationOn[] = {0x2, 0x0};
+const bool indications = false;  //false as first argument to subscribe to indications instead of notifications
+const bool notifications = true; //true as first argument to subscribe to notifications
+// ---------------------------------------------------------------------------------------
+// Libraries for use of I2C devices (Oled and VL6180X distance sensor)
+#include <SPI.h>
+#include <Wire.h>
+// Necessary libraries for use of Oled display(s)
+#include <Adafruit_GFX.h>
+#include <Adafruit_SSD1306.h>
+// Additional splash screen bitmap and icon(s) for Oled
+#include "Adafruit_SSD1306_Icons.h" // needs to be in the SAME (!) directory
+// Declarations for an SSD1306 128x64 display connected to I2C (SDA, SCL pins)
+#define SCREEN_WIDTH 128            // SSD1306-OLED display width, in pixels
+#define SCREEN_HEIGHT 64            // SSD1306-OLED display height, in pixels
+#define OLED_RESET -1               // No reset pin on this OLED display
+#define OLED_I2C_ADDRESS 0x3C       // I2C Address of OLED display
+#define OLED_I2C_CLOCK 400000UL     // I2C clock during Oled transfers (Adafruit_SSD1306 default)
+#define OLED_I2C_RESTORE 100000UL   // I2C clock after Oled transfers (Adafruit_SSD1306 default)
+#define OLED_WIRE_MAX 32            // Bytes per I2C transmission, same chunking as display()
+// Adafruit_SSD1306 extended with a clip rectangle: drawing outside of it leaves the buffer untouched
+// Adafruit_GFX funnels all pixels, lines, rectangles, triangles, bitmaps and text through these three!
+// displayRegion() sends only the pages and columns of a dirty region instead of the full buffer
+class Clipped_SSD1306 : public Adafruit_SSD1306 {
+  public:
+    Clipped_SSD1306(uint8_t w, uint8_t h, TwoWire *twi, int8_t rst_pin) : \
+                    Adafruit_SSD1306(w, h, twi, rst_pin, OLED_I2C_CLOCK, OLED_I2C_RESTORE), I2CWire(twi) {}
+    bool begin(uint8_t switchvcc, uint8_t i2caddr) {
+      I2CAddress = i2caddr;
+      return Adafruit_SSD1306::begin(switchvcc, i2caddr);
+    }
+    // Region in buffer coordinates, y and h are rounded to whole pages (8 rows)
+    void displayRegion(int16_t x, int16_t y, int16_t w, int16_t h) {
+      if (x < 0) { w += x; x = 0; }
+      if (y < 0) { h += y; y = 0; }
+      if ((x + w) > WIDTH) w = WIDTH - x;
+      if ((y + h) > HEIGHT) h = HEIGHT - y;
+      if ((w <= 0) || (h <= 0)) return;
+      uint8_t FirstPage = y / 8, LastPage = (y + h - 1) / 8;
+      // A 64x48 panel is wired to columns 32-95 of the SSD1306 RAM, newer Adafruit_SSD1306 display() does the same
+      uint8_t Column = ((WIDTH == 64) && (HEIGHT == 48)) ? 32 + x : x;
+      ssd1306_command(SSD1306_PAGEADDR);
+      ssd1306_command(FirstPage);
+      ssd1306_command(LastPage);
+      ssd1306_command(SSD1306_COLUMNADDR);
+      ssd1306_command(Column);
+      ssd1306_command(Column + w - 1);
+      uint8_t *Buffer = getBuffer();
+      I2CWire->setClock(OLED_I2C_CLOCK);
+      I2CWire->beginTransmission(I2CAddress);
+      I2CWire->write((uint8_t)0x40); // Co = 0, D/C = 1: data follows
+      uint8_t BytesOut = 1;
+      for (uint8_t Page = FirstPage; Page <= LastPage; Page++) {
+        uint8_t *Ptr = &Buffer[Page * WIDTH + x];
+        for (int16_t Count = w; Count > 0; Count--) {
+          if (BytesOut >= OLED_WIRE_MAX) {
+            I2CWire->endTransmission();
+            I2CWire->beginTransmission(I2CAddress);
+            I2CWire->write((uint8_t)0x40);
+            BytesOut = 1;
+          }
+          I2CWire->write(*Ptr++);
+          BytesOut++;
+        }
+      }
+      I2CWire->endTransmission();
+      I2CWire->setClock(OLED_I2C_RESTORE);
+    }
+    void setClipRect(int16_t x, int16_t y, int16_t w, int16_t h) {
+      clipX0 = x; clipY0 = y; clipX1 = x + w - 1; clipY1 = y + h - 1;
+    }
+    void resetClipRect(void) { setClipRect(0, 0, WIDTH, HEIGHT); }
+    void drawPixel(int16_t x, int16_t y, uint16_t color) {
+      if ((x < clipX0) || (x > clipX1) || (y < clipY0) || (y > clipY1)) return;
+      Adafruit_SSD1306::drawPixel(x, y, color);
+    }
+    void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+      if ((y < clipY0) || (y > clipY1)) return;
+      int16_t x1 = min((int16_t)(x + w - 1), clipX1);
+      x = max(x, clipX0);
+      if (x1 >= x) Adafruit_SSD1306::drawFastHLine(x, y, x1 - x + 1, color);
+    }
+    void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+      if ((x < clipX0) || (x > clipX1)) return;
+      int16_t y1 = min((int16_t)(y + h - 1), clipY1);
+      y = max(y, clipY0);
+      if (y1 >= y) Adafruit_SSD1306::drawFastVLine(x, y, y1 - y + 1, color);
+    }
+  private:
+    int16_t clipX0 = 0, clipY0 = 0, clipX1 = SCREEN_WIDTH - 1, clipY1 = SCREEN_HEIGHT - 1;
+    TwoWire *I2CWire;
+    uint8_t I2CAddress = OLED_I2C_ADDRESS;
+};
+// Declare the display
+Clipped_SSD1306 display(SCREEN_WIDTH, SCREEN_HEIGHT, &Wire, OLED_RESET);
+// Declare Global var for OLED Display selection 1 (Cycling data) or 2 (Road Grade)
+uint8_t OledDisplaySelection = 2; // default Road Grade to show
+// ------------------------- Oled Screen Sequencer definitions ---------------------------
+// Timed screens (splash, test status, messages) are queued and shown one after another by
+// the xDisplaySequencer task --> a caller of ShowOnOledLarge() or alike is never blocked!
+#define SCREEN_QUEUE_LENGTH 8       // Max number of timed screens waiting to be shown
+#define SCREEN_LINE_LEN 11          // Max 10 large characters (plus end of string) fit on a line
+typedef enum { SCREEN_BITMAP, SCREEN_TEXT_LARGE } screen_type_t;
+typedef struct {
+  screen_type_t Type;
+  const unsigned char *Bitmap;      // SCREEN_BITMAP: NULL shows the display buffer as is
+  int16_t BitmapWidth;
+  int16_t BitmapHeight;
+  char Line[3][SCREEN_LINE_LEN];    // SCREEN_TEXT_LARGE: empty lines are skipped
+  uint16_t Pause;                   // Minimal time (ms) the screen is shown before the next one
+} screen_item_t;
+QueueHandle_t xScreenQueue = NULL;
+TaskHandle_t DisplayTaskHandle = NULL;
+// Run xDisplaySequencer on "Core 1" next to the Arduino loop
+const BaseType_t xDisplayCoreID = 1;
+void xDisplaySequencer(void* arg);
+// Road Grade screen updates are merged and paced by the render scheduler: the display task shows
+// the latest value only, at most OLED_MAX_FPS and with OLED_MIN_IDLE_MS between two frames
+// to leave the I2C bus (shared with the VL6180X sensor) some breathing space
+#include <RenderScheduler.h>
+#define OLED_MAX_FPS 10
+#define OLED_MIN_IDLE_MS 20
+RenderScheduler OledScheduler;
+// ------------------------- Oled Widget definitions -------------------------------------
+// Retained-mode widgets of the Road Grade screen: every widget remembers what is on the Oled
+// (Drawn) and what should be shown (Value). Only when these differ, the widget box is dirty and
+// only the dirty region of the screen buffer is cleared, redrawn and flushed to the Oled!
+typedef struct {
+  int16_t x, y, w, h;  // Widget box on the Oled
+  int32_t Value;       // State to show at the next update
+  int32_t Drawn;       // State that is shown on the Oled right now
+} oled_widget_t;
+enum { WIDGET_LEFT_ICON, WIDGET_RIGHT_ICON, WIDGET_GRADE_FIELD, WIDGET_SLOPE_GAUGE, WIDGET_COUNT };
+oled_widget_t SlopeScreenWidgets[WIDGET_COUNT] = {
+  {   0, 0, 16, 16, 0, 0 },  // Icon slot: Zwift (1) and/or Phone (2) connected
+  { 112, 0, 16, 16, 0, 0 },  // Icon slot: Trainer connected
+  {  10, 6, 90, 24, 0, 0 },  // Numeric field: Road Grade in steps of 0.1%
+  {   0, 0,  0,  0, 0, 0 }   // Slope gauge: box is set by the gauge height
+};
+// False when another screen has overwritten the Oled --> next update is a full redraw
+bool IsSlopeScreenValid = false;
+// ---------------------------------------------------------------------------------------
+
+// LittleFS for internal storage of persistent data on the ESP32
+#include <LittleFS.h>
+using namespace fs;
+// Managing persistence of some data with LittleFS system
+// PeRSistent Data is written to a file with the name: PRS_FILENAME
+#define PRS_FILENAME "/prsdata.txt"
+// Minimum(!) Read and Write block sizes
+#define LITTLEFS_BLOCK_SIZE 128
+#define FORMAT_LITTLEFS_IF_FAILED true
+// LittleFS--------------------------------------------------------------
+
+
+//----------- Global variable definitions for high level movement control -----------------------------------------------
+// In theory the RawgradeValue varies between 0 (equals -200% grade) and 40000 (equals +200% grade)
+// SIMCLINE is mechanically working between -10% and +20% --> 19000 and 22000
+
+//------------------------------------------------- WARNING --------------------------------------------------------------
+//------------ SET THESE TWO VALUES IN ACCORDANCE WITH THE MECHANICAL RANGE LIMITATIONS OF YOUR SIMCLINE !!! -------------
+// Raw Grade Value Minimally (Mechanically: the lowest position of wheel axis)  19000 is equiv. of 10% downhill road grade
+#define RGVMIN 19500 // -5%  // Always is RGVMIN < 20000 (flat road level)
+// Raw Grade Value Maximally (Mechanically: the highest position of wheel axis) 22000 is equiv. of 20% uphill road grade
+#define RGVMAX 22000 // 20%  // +20% // Always is RGVMAX > 20000 (flat road level)
+//------------------------------------------------- WARNING --------------------------------------------------------------
+
+// Correction for measuring plane difference and midth wheel axis position (1 cm offset is an MEASUREOFFSET of about 40)
+#define MEASUREOFFSET 50 // about 1.25 cm
+// Raw Grade Value Minimally (Mechanically: the lowest position of wheel axis)  19000 is equiv. of 10% downhill road grade
+// These values are derived from the above RGVMIN and RGVMAX settings
+#define RGVMIN_GRADE (20000-RGVMIN)/100 // Notice: positive value of the Minimal downhill grade! 
+#define RGVMAX_GRADE (RGVMAX-20000)/100 // Notice: positive value of the Maximal uphill grade!
+// Besides what is mechanically possible there are also limits in what is physically pleasant
+// Keep the following aRGVMin and aRGVMax values within the limits of the mechanically feasible values of above !!!
+// DEFAULT Minimally Allowed Raw Grade Value that should not be exceeded: -5%! -> Descent grade Limit
+int aRGVmin = 19500;
+// DEFAULT Maximally Allowed Raw Grade Value that should not be exceeded: 15%! -> Ascent grade limit
+int aRGVmax = 21500;
+// Value for a flat road equals 0% grade or a RGV of 20000; result needs to be corrected for the measure offset
+long RawgradeValue = (20000 - MEASUREOFFSET);
+int GradeChangeFactor = 100; // 100% means no effect, 50% means only halved up/down steps --> Road Grade Change Factor
+// The Grade Percentage of a road is defined as a measure of the road's steepness as it rises and falls along its route
+float gradePercentValue = 0;
+//-----------------------------------------------------------------
+
+/* ------------------------------------------------------------------------------------------------
+ * Warning I/O Pins can have identical board position but different I/O Pin declarations for 
+ * connection with the pins of the Motor driver board
+ * ADAFRUIT_FEATHER_ESP32_V2 is nearly pin compatible with ARDUINO_NRF52840_FEATHER
+*/
+#ifdef ADAFRUIT_FEATHER_ESP32_V2
+#define actuatorOutPin1 A0   // --> A0/P0.02 connected to pin IN2 of the DRV8871 Motor Driver board
+#define actuatorOutPin2 A1   // --> A1/P0.03 connected to pin IN1 of the DRV8871 Motor Driver board
+#endif
+
+// -------------------------- WARNING ------------------------------------------------------------
+// The following VL6180X sensor values are a 100% construction specific and
+// should be experimentally determined, when the Actuator AND the VL6180X sensor are mounted!
+// ------>>>> Test manually and use example/test sketches that go with the VL6180X sensor! <<<<---
+// Microswitches should limit physically/mechanically the upper and lower position of the Actuator!
+// The microswitches are mechanically controlled, and NOT by the software --> should be fail safe!
+// Notice that unrestricted movement at the boundaries can damage the Actuator and/or construction!
+// The following values are respected by the software and will (in normal cases!) never be exceeded!
+#define MINPOSITION 270 // 265 // VL6180X highest value top microswitch activated to mechanically stop operation
+#define MAXPOSITION 470 // 535 // VL6180X lowest value bottom microswitch activated to mechanically stop operation
+
+// -------------------------- WARNING ------------------------------------------------------------
+// Operational boundaries of the VL6180X sensor are used/set in class Lifter after calling its "init".
+// A safe measuring range of at least 30 cm of total movement is recommended for the VL6180X sensor setting!
+//
+// Bandwidth is used in the code to take measuring errors and a safe margin into account when reaching
+// the above defined max or min positions of the construction! The software does painstakingly respect
+// these and is independent of the appropriate working of the microswitches when reaching the boundaries!
+// These microswitches are a SECOND line of defence against out of range and potentially damaging movement!
+#define BANDWIDTH 4
+
+// Library code for low level measuring (VL6180X) and controlling UP and down movement
+#include <Lifter.h> 
+// Decalaration of Lifter Class for control of the low level up/down movement
+Lifter lift;
+// Global variables for Lifter position control --> RawGradeValue has been defined/set previously to flat road level!!
+int16_t TargetPosition = map(RawgradeValue, RGVMIN, RGVMAX, MAXPOSITION, MINPOSITION);
+bool IsBasicMotorFunctions = false; // Mechanical motor functions
+// ----------------------xControlUpDownMovement task definitions ------------------
+SemaphoreHandle_t xSemaphore = NULL;
+TaskHandle_t ControlTaskHandle = NULL;
+// Set Arduino IDE Tools Menu --> Events Run On: "Core 1"
+// Set Arduino IDE Tools Menu --> Arduino Runs On: "Core 1"
+// Run xControlUpDownMovement on "Core 0"
+const BaseType_t xControlCoreID = 0;
+void xControlUpDownMovement(void* arg); 
+// ----------------------Task placement plan -------------------------------------
+// Core, priority and stack of every task of the sketch: change them here only.
+// For reference: NimBLE's host task runs on CONFIG_BT_NIMBLE_PINNED_TO_CORE (default core 0) at a high priority,
+// the BT controller on core 0 as well, Arduino loop() runs on ARDUINO_RUNNING_CORE (core 1) at priority 1
+typedef struct {
+  const char *Name;
+  TaskFunction_t Function;
+  uint32_t StackSize;              // Bytes
+  UBaseType_t Priority;
+  BaseType_t CoreID;               // tskNO_AFFINITY -> the scheduler picks a core
+  TaskHandle_t *Handle;
+  volatile unsigned long WakeDue;  // micros() when the task should run (notified or end of delay), 0 -> not waiting
+  unsigned long LatencySum;        // Wake-up (scheduling) latency in us since the last report
+  unsigned long LatencyCount;
+  unsigned long LatencyMax;
+} task_plan_t;
+enum { TASK_CONTROL, TASK_DISPLAY, TASK_CP_WRITER, TASK_FORWARDER, TASK_PLANNED };
+task_plan_t TaskPlan[TASK_PLANNED] = {
+  {"xControlUpDownMovement", xControlUpDownMovement, 4096, 10, xControlCoreID, &ControlTaskHandle},
+  {"xDisplaySequencer",      xDisplaySequencer,      4096,  1, xDisplayCoreID, &DisplayTaskHandle},
+  {"xControlPointWriter",    xControlPointWriter,    4096,  1, tskNO_AFFINITY, &ControlPointWriterHandle},
+  {"xNotifyForwarder",       xNotifyForwarder,       4096,  1, tskNO_AFFINITY, &NotifyForwarderHandle}
+};
+#define TASK_STATS_MAX 24 // Tasks listed with their CPU usage (all tasks of the system, when run time stats are enabled)
+void StartPlannedTask(uint8_t Task);
+void NotifyPlannedTask(uint8_t Task);
+void PlannedTaskDue(uint8_t Task, unsigned long Delay);
+void PlannedTaskWoken(uint8_t Task);
+void ShowTaskStats(void);
+// --------------------------------------------------------------------------------
+// Client Connect and Disconnect callbacks defined
+class client_Connection_Callbacks:public BLEClientCallbacks {
+  void onConnect(BLEClient* pClient);
+  void onDisconnect(BLEClient* pClient);
+  bool onConnParamsUpdateRequest(BLEClient* pClient, ble_gap_upd_params *params);
+  };
+// Server Connect and Disconnect callbacks defined
+class server_Connection_Callbacks:public BLEServerCallbacks {
+  void onConnect(BLEServer* pServer, ble_gap_conn_desc* desc);
+  void onDisconnect(BLEServer* pServer, ble_gap_conn_desc* desc);
+  void onMTUChange(uint16_t MTU, ble_gap_conn_desc* desc);
+};
+// Handler class for Server CPS, CSC, HRM, FTMS Characteristics action(s) defined
+class CharacteristicCallbacks:public NimBLECharacteristicCallbacks {
+/*  We only define onSubscribe !!!
+    void onRead(NimBLECharacteristic* pCharacteristic);
+    void onWrite(NimBLECharacteristic* pCharacteristic);
+    void onNotify(NimBLECharacteristic* pCharacteristic);    
+    void onStatus(NimBLECharacteristic* pCharacteristic, Status status, int code);
+*/    
+    void onSubscribe(NimBLECharacteristic* pCharacteristic, ble_gap_conn_desc* desc, uint16_t subValue);
+};    
+// Define CharacteristicCallbacks instance(s) globally to use for multiple Server Characteristics 
+static CharacteristicCallbacks server_Multi_Chr_Callbacks;
+// Connection callbacks are allocated statically as well: no new, and never deleted by NimBLE
+static client_Connection_Callbacks client_Conn_Callbacks;
+static server_Connection_Callbacks server_Conn_Callbacks;
+// Server Characteristic values are copied into fixed size buffers (no std::string per write), longer writes are truncated
+#define SERVER_VALUE_MAXLEN 20
+#if defined(CONFIG_NIMBLE_CPP_ATT_VALUE_INIT_LENGTH) && (SERVER_VALUE_MAXLEN > CONFIG_NIMBLE_CPP_ATT_VALUE_INIT_LENGTH)
+#error "SERVER_VALUE_MAXLEN is read in one piece: it can not exceed the initial attribute value buffer"
+#endif
+typedef struct { uint8_t Bytes[SERVER_VALUE_MAXLEN]; } server_value_t;
+uint8_t GetServerValue(NimBLECharacteristic *pCharacteristic, uint8_t *Data);
+// Heap usage is reported periodically: a long ride should neither grow nor fragment the heap
+#include "esp_heap_caps.h"
+#define HEAP_REPORT_PERIOD 600000 // ms, 10 minutes
+unsigned long HeapReportTime = 0;
+uint32_t HeapBaseline = 0;        // Free heap at the first report with the trainer connected
+void ShowHeapUsage(void);
+void server_NUS_Txd_Heap_Usage(void);
+
+bool getPRSdata(void);
+void setPRSdata(void);
+bool getTrainerData(void);
+void setTrainerData(void);
+void ConvertMacAddress(char *fullAddress, uint8_t addr[6], bool NativeFormat);
+#ifdef EMA_ALPHA
+int16_t EMA_TargetPositionFilter(int16_t current_value);
+#endif
+void ShowIconsOnTopBar(void);
+void ShowOnOledLarge(const char* Line1, const char* Line2, const char* Line3, uint16_t Pause);
+void ShowBitmapOnOled(const unsigned char *Bitmap, int16_t w, int16_t h, uint16_t Pause);
+bool QueueScreenOnOled(const screen_item_t *Screen);
+void DrawScreenOnOled(const screen_item_t *Screen);
+void ShowSlopeTriangleOnOled(void);
+void DrawSlopeTriangleOnOled(void);
+void SetSlopeGaugeBox(oled_widget_t *Gauge, int32_t State);
+void SetManualGradePercentValue(void);
+void SetNewRawGradeValue(float RoadGrade);
+void SetNewActuatorPosition(void);
+
+void server_setupGA(void);
+void server_setupDIS(void);
+void server_setupHRM(void);
+void server_setupNUS(void);
+void ShowBridgeLatency(void);
+void server_NUS_Txd_Bridge_Latency(void);
+void ShowConnectionState(void);
+void server_NUS_Txd_Connection_State(void);
+void server_setupFTMS(void);
+void server_setupCSC(void);
+void server_setupCPS(void);
+void server_startADV(void);
+void client_Start_Scanning(void);
+bool client_Connect_Callback(void);
+void client_Remember_Trainer(void);
+// ---------------------------------------------------------------------------------
+
+void setup() {
+
+  Serial.begin(115200);
+  while (!Serial) delay(10); 
+  Serial.flush();
+  delay(1000); // Give Serial I/O time to settle
+
+/* The Feather ESP32 V2 has a NEOPIXEL_I2C_POWER pin that must be pulled HIGH
+ * to enable power to the STEMMA QT port. Without it, the QT port will not work!
+ */
+#ifdef ADAFRUIT_FEATHER_ESP32_V2
+  // Turn on the I2C power on Stemma connector by pulling pin HIGH.
+  pinMode(NEOPIXEL_I2C_POWER, OUTPUT);
+  digitalWrite(NEOPIXEL_I2C_POWER, HIGH);
+#endif
+  DEBUG_PRINTLN("");
+  DEBUG_PRINTLN("ESP32 NimBLE SIMCLINE supporting: CPS, CSC, HBM and FTMS");
+  DEBUG_PRINTLN("-------------------- Version 01.6 ----------------------");
+  DEBUG_PRINTLN(THISDEVICENAME);
+  delay(200);
+  // LittleFS start the Littlefilesystem lib and see if we have persistent data ----
+  // This opens LittleFS with a root subdirectory /littlefs/
+  LittleFS.begin();
+  // WARNING --------- Uncomment only when strictly necessary!!! ---------
+  // Uncomment only the very first time the Simcline code is executed!!!
+  /* This creates LittleFS with a root subdirectory /littlefs/
+  LittleFS.format();
+  DEBUG_PRINTLN("Wipe out all persistent data, including any file(s)....");
+  */
+  // Get or set (first time only) the values of relevant and crucial variables
+  // to persistence, whith the Companion App the user can set these on the fly!
+  // Get or set the values of aRGVmax, aRGVmin, GradeChangeFactor in PRSdata.
+  if (!getPRSdata()) {
+    setPRSdata();
+  }
+  // Get the last successfully used trainer, if any, to connect to directly
+  IsTrainerRemembered = getTrainerData();
+  // LittleFS------------------------------------------------------------------------
+  
+  // Start the show for the Oled display
+  if (!display.begin(SSD1306_SWITCHCAPVCC, OLED_I2C_ADDRESS)) {
+    DEBUG_PRINTLN(F("SSD1306 OLED display allocation failed!"));
+  } else {
+    DEBUG_PRINTLN(F("SSD1306 OLED display is running..."));
+    // Start the Screen Sequencer task that shows all (queued) screens on the Oled
+    xScreenQueue = xQueueCreate(SCREEN_QUEUE_LENGTH, sizeof(screen_item_t));
+    OledScheduler.Init(OLED_MAX_FPS, OLED_MIN_IDLE_MS);
+    StartPlannedTask(TASK_DISPLAY);
+    // Load Oled with initial display buffer contents on the screen,
+    // the SSD1306 library initializes with a Adafruit splash screen,
+    // (respect or edit the splash.h in the library).
+    ShowBitmapOnOled(NULL, 0, 0, 500); // Acknowledge Adafruit rights, license and efforts
+  }
+  // Queue our own SIMCLINE splash screen and take somewhat more time.....
+  ShowBitmapOnOled(Mountain_bw_79x64, 79, 64, 2000);
+  //Show Name and SW version on Oled
+  ShowOnOledLarge("SIMCLINE", "FTMS", "v01.6", 500);
+  // Initialize Lifter Class data, variables, test and set to work !
+  lift.Init(actuatorOutPin1, actuatorOutPin2, MINPOSITION, MAXPOSITION, BANDWIDTH);
+  // Test Actuator and VL8106X for proper functioning
+  ShowOnOledLarge("Testing", "Up & Down", "Functions", 100);
+  if (!lift.TestBasicMotorFunctions()) {
+    ShowOnOledLarge("Testing", "Functions", "Failed!", 500);
+    IsBasicMotorFunctions = false; // Not working properly
+    DEBUG_PRINTLN("Simcline >> ERROR << Basic Motor Funtions are NOT working!!");
+  } else {
+    ShowOnOledLarge("Testing", "Functions", "Done!", 500);
+    // Is working properly --> Start Motor Control Task
+    xSemaphore = xSemaphoreCreateBinary();
+    StartPlannedTask(TASK_CONTROL);
+    xSemaphoreGive(xSemaphore);
+    DEBUG_PRINTLN("Motor Control Task Created and Active!");        
+    IsBasicMotorFunctions = true;
+    DEBUG_PRINTLN("Simcline Basic Motor Funtions are working!!");
+    // Put Simcline in neutral: flat road position
+#ifdef EMA_ALPHA
+    // Init EMA filter at first call with flat road position as reference
+    TargetPosition = EMA_TargetPositionFilter(TargetPosition); 
+#endif
+    SetNewActuatorPosition();
+  }
+  // Set the connection parameter policies of the trainer and app (Zwift) links
+  TrainerLink.Init("Trainer", TrainerActiveParams, TrainerIdleParams, LINK_IDLE_AFTER);
+  AppLink.Init("App", AppActiveParams, AppIdleParams, LINK_IDLE_AFTER);
+  // Initialize NimBLE with maximum connections as Peripheral = 1, Central = 1
+  BLEDevice::init(THISDEVICENAME); // Give the device a Shortname    
+  // Largest ATT MTU we accept/request on both the client and server side
+  BLEDevice::setMTU(PREFERRED_MTU);
+  // Events of the connection state machine in loop()
+  xConnectionEvents = xEventGroupCreate();
+  // Synchronous ATT requests and routing of trainer notifications for the GATT cache fast path
+  xGattRequestMutex = xSemaphoreCreateMutex();
+  xGattRequestDone = xSemaphoreCreateBinary();
+  xCCCDDone = xSemaphoreCreateBinary();
+  ble_gap_event_listener_register(&GattCacheListener, client_GattCache_Event, NULL);
+  // Start the Control Point Writer task that passes the app's commands on to the trainer
+  xControlPointQueue = xQueueCreate(CONTROL_POINT_QUEUE_LENGTH, sizeof(ftmcp_frame_t));
+  StartPlannedTask(TASK_CP_WRITER);
+  // Start the Notify Forwarder task that passes the trainer's notifications on to the app(s)
+  for(uint8_t i = 0; i < MAX_CENTRALS; i++) Centrals[i].conn_handle = BLE_HS_CONN_HANDLE_NONE;
+  xCentralMutex = xSemaphoreCreateMutex();
+  StartPlannedTask(TASK_FORWARDER);
+  // Start the Server-side now!
+  pServer = BLEDevice::createServer();
+  //Setup callbacks onConnect and onDisconnect
+  pServer->setCallbacks(&server_Conn_Callbacks, false);
+  // Advertising is restarted (fast) by server_Connection_Callbacks::onDisconnect()
+  pServer->advertiseOnDisconnect(false);  
+  // Server setup
+  DEBUG_PRINTLN("Configuring the default Generic Access Service");
+  server_setupGA();
+  DEBUG_PRINTLN("Configuring the Server Nordic Uart Service");  
+  server_setupNUS();
+  DEBUG_PRINTLN("Configuring the Server Device Information Service");
+  server_setupDIS();
+  DEBUG_PRINTLN("Configuring the Server Cycle Power Service");
+  server_setupCPS();
+  DEBUG_PRINTLN("Configuring the Server Cadence and Speed Service");  
+  server_setupCSC();
+  DEBUG_PRINTLN("Configuring the Server Fitness Machine Service");  
+  server_setupFTMS();
+  DEBUG_PRINTLN("Configuring the Server Heart Rate Service");  
+  server_setupHRM();
+  DEBUG_PRINTLN("Setting up the Server advertising payload(s)");
+  server_startADV();
+  //BLEDevice::stopAdvertising(); 
+  DEBUG_PRINTLN("Server is advertising: CPS, CSC and FTMS");    
+    
+  // Start the Client-side! Direct connect to a remembered trainer, else scan for it
+  // The scan does not block: loop() connects as soon as the trainer is found, or retries with backoff
+  // The server keeps advertising in the meantime: the app can connect while the trainer is searched for
+  ConnectionStateTime = RecoverStartTime = millis();
+  RecoverAttempts = 1;
+  if(!client_Direct_Connect()) client_Start_Scanning();
+  //BLEDevice::startAdvertising(); 
+  //DEBUG_PRINTLN("Server is advertising: CPS, CSC and FTMS"); 
+} // End of setup.
+
+// LittleFS --------------------------------------------------
+bool getPRSdata(void) { // aRGVmax, aRGVmin, GradeChangeFactor -> PRSdata
+  if (LittleFS.exists(PRS_FILENAME)) {
+    File file = LittleFS.open(PRS_FILENAME, FILE_READ);
+    if (file) {    
+      uint32_t readLen;
+      uint8_t buffer[LITTLEFS_BLOCK_SIZE+1] = { 0 };
+      readLen = file.read(buffer, LITTLEFS_BLOCK_SIZE);
+      buffer[readLen] = 0; // set the values to the pointed by variables
+      sscanf((char*)buffer, "%d %d %d %d", &aRGVmax, &aRGVmin, &GradeChangeFactor, &OledDisplaySelection);
+      DEBUG_PRINT(F("ESP32 internally Got persistent storage from: /littlefs/PRSdata -> "));
+      DEBUG_PRINTF("Max: %d Min: %d Perc.: %d Displ.: %d\n", aRGVmax, aRGVmin, GradeChangeFactor, OledDisplaySelection);
+      file.close();
+      return true;
+    }    
+  }
+  return false;
+}
+
+void setPRSdata(void) { // aRGVmax, aRGVmin, GradeChangeFactor -> PRSdata
+  uint8_t buffer[LITTLEFS_BLOCK_SIZE+1] = { 0 };
+  File file = LittleFS.open(PRS_FILENAME, FILE_WRITE);
+  if (file) {
+      sprintf((char*)buffer, "%d %d %d %d", aRGVmax, aRGVmin, GradeChangeFactor, OledDisplaySelection);
+      file.write(buffer, LITTLEFS_BLOCK_SIZE);
+      file.close();
+      DEBUG_PRINT(F("ESP32 internally Set new values in persistent storage to: /littlefs/PRSdata -> "));
+      DEBUG_PRINTLN((char*)buffer);
+  }
+}
+
+bool getTrainerData(void) { // Trainer.PeerAddress, TrainerAddressType, Trainer.PeerName -> TRAINER_FILENAME
+  if (LittleFS.exists(TRAINER_FILENAME)) {
+    File file = LittleFS.open(TRAINER_FILENAME, FILE_READ);
+    if (file) {
+      uint32_t readLen;
+      uint8_t buffer[LITTLEFS_BLOCK_SIZE+1] = { 0 };
+      readLen = file.read(buffer, LITTLEFS_BLOCK_SIZE);
+      buffer[readLen] = 0;
+      file.close();
+      unsigned int Address[6], Type;
+      char Name[32] = { 0 };
+      if (sscanf((char*)buffer, "%02X%02X%02X%02X%02X%02X %u %31[^\n]", &Address[5], &Address[4], &Address[3], \
+                                 &Address[2], &Address[1], &Address[0], &Type, Name) < 7) return false;
+      uint8_t Remembered[6];
+      for (int i = 0; i < 6; i++) Remembered[i] = (uint8_t)Address[i];
+      // A configured TRAINERADDRESS (not the placeholder) has priority: the user has switched trainers
+      if ( !IS_ANY_TRAINER && (memcmp(TrainerConfigured, Remembered, 6) != 0) ) return false;
+      memcpy(Trainer.PeerAddress, Remembered, 6);
+      TrainerAddressType = (uint8_t)Type;
+      if (Name[0] != 0) Trainer.PeerName = Name;
+      DEBUG_PRINTF("ESP32 internally Got remembered trainer from: /littlefs%s -> [%s] Type: %d\n", TRAINER_FILENAME, buffer, TrainerAddressType);
+      return true;
+    }
+  }
+  return false;
+}
+
+void setTrainerData(void) { // Trainer.PeerAddress, TrainerAddressType, Trainer.PeerName -> TRAINER_FILENAME
+  uint8_t buffer[LITTLEFS_BLOCK_SIZE+1] = { 0 };
+  File file = LittleFS.open(TRAINER_FILENAME, FILE_WRITE);
+  if (file) {
+      snprintf((char*)buffer, LITTLEFS_BLOCK_SIZE, "%02X%02X%02X%02X%02X%02X %u %.31s", Trainer.PeerAddress[5], Trainer.PeerAddress[4], \
+               Trainer.PeerAddress[3], Trainer.PeerAddress[2], Trainer.PeerAddress[1], Trainer.PeerAddress[0], TrainerAddressType, Trainer.PeerName.c_str());
+      file.write(buffer, LITTLEFS_BLOCK_SIZE);
+      file.close();
+      DEBUG_PRINTF("ESP32 internally Set remembered trainer in: /littlefs%s -> ", TRAINER_FILENAME);
+      DEBUG_PRINTLN((char*)buffer);
+  }
+}
+// LittleFS --------------------------------------------------
+
+void ConvertMacAddress(char *fullAddress, uint8_t addr[6], bool NativeFormat)
+{ // Display byte by byte in HEX 
+  if(NativeFormat) { // Unaltered: in Little Endian machine-representation
+    sprintf(fullAddress, "%02X:%02X:%02X:%02X:%02X:%02X", addr[0], addr[1], addr[2], \
+      addr[3], addr[4], addr[5], HEX);   
+  } else { // Altered: In reversed order
+    sprintf(fullAddress, "%02X:%02X:%02X:%02X:%02X:%02X", addr[5], addr[4], addr[3], \
+      addr[2], addr[1], addr[0], HEX);       
+  }
+};
+
+void ShowIconsOnTopBar(void) {
+  // Show Icons on Top Bar, as set in the icon slot widgets
+  if (SlopeScreenWidgets[WIDGET_RIGHT_ICON].Value) { // show icon
+    display.drawBitmap(112, 0, power_icon16x16, 16, 16, 1);
+  }
+  if (SlopeScreenWidgets[WIDGET_LEFT_ICON].Value & 1) { // show icon
+    display.drawBitmap(0, 0, zwift_icon16x16, 16, 16, 1);
+  }
+  if (SlopeScreenWidgets[WIDGET_LEFT_ICON].Value & 2) { // show icon Phone
+    display.drawBitmap(0, 0, mobile_icon16x16, 16, 16, 1);
+  }
+}
+
+void ShowOnOledLarge(const char* Line1, const char* Line2, const char* Line3, uint16_t Pause) {
+  // Queue a 3 line info screen to be shown (at least) Pause ms -> does not block the caller!
+  screen_item_t Screen = { SCREEN_TEXT_LARGE, NULL, 0, 0, { {0}, {0}, {0} }, Pause };
+  if (Line1) strlcpy(Screen.Line[0], Line1, SCREEN_LINE_LEN);
+  if (Line2) strlcpy(Screen.Line[1], Line2, SCREEN_LINE_LEN);
+  if (Line3) strlcpy(Screen.Line[2], Line3, SCREEN_LINE_LEN);
+  QueueScreenOnOled(&Screen);
+}
+
+void ShowBitmapOnOled(const unsigned char *Bitmap, int16_t w, int16_t h, uint16_t Pause) {
+  // Queue a (splash) bitmap screen, Bitmap == NULL shows the current display buffer contents
+  screen_item_t Screen = { SCREEN_BITMAP, Bitmap, w, h, { {0}, {0}, {0} }, Pause };
+  QueueScreenOnOled(&Screen);
+}
+
+bool QueueScreenOnOled(const screen_item_t *Screen) {
+  if (xScreenQueue == NULL) return false; // Oled display is not running
+  if (xQueueSend(xScreenQueue, Screen, 0) != pdTRUE) { // Never wait for a free slot!
+    DEBUG_PRINTLN("Screen Sequencer queue is full -> screen is skipped!");
+    return false;
+  }
+  NotifyPlannedTask(TASK_DISPLAY);
+  return true;
+}
+
+void DrawScreenOnOled(const screen_item_t *Screen) {
+  int pos = 1;
+  IsSlopeScreenValid = false; // Road Grade screen is overwritten
+  if (Screen->Type == SCREEN_BITMAP) {
+    if (Screen->Bitmap) { // Show bitmap horizontally centered
+      display.clearDisplay();
+      display.drawBitmap((SCREEN_WIDTH - Screen->BitmapWidth) / 2, 0, Screen->Bitmap, \
+                          Screen->BitmapWidth, Screen->BitmapHeight, 1);
+    }
+    display.display();
+    return;
+  }
+  // Clear and set Oled to display 3 line info -> centered
+  display.clearDisplay();
+  display.setTextColor(SSD1306_WHITE);
+  // ShowIconsOnTopBar();
+  display.setTextSize(2);  // Large characters 11 pixels wide
+  const int16_t ypos[3] = { 2, 22, 44 };
+  for (uint8_t i = 0; i < 3; i++) {
+    if (Screen->Line[i][0] == 0) continue;
+    pos = round( (127 - (12 * strlen(Screen->Line[i]))) / 2 );
+    display.setCursor(pos, ypos[i]); // 16
+    display.print(Screen->Line[i]);
+  }
+  display.display();
+}
+
+void ShowSlopeTriangleOnOled(void) {
+  // Request the display task to (re)draw the Road Grade screen with the latest value
+  // Consecutive requests are merged: only the most recent grade is shown!
+  if (DisplayTaskHandle == NULL) return;
+  OledScheduler.RequestFrame();
+  NotifyPlannedTask(TASK_DISPLAY);
+}
+
+void SetSlopeGaugeBox(oled_widget_t *Gauge, int32_t State) {
+  // State = (gauge height << 1) | uphill, the gauge occupies the bottom rows up to its top
+  int16_t top = min(64 - (int16_t)(State >> 1), 63); // Baseline row 63 is always included
+  Gauge->x = 0; Gauge->y = top; Gauge->w = SCREEN_WIDTH; Gauge->h = SCREEN_HEIGHT - top;
+}
+
+void DrawSlopeTriangleOnOled(void) {
+  // Set the widget values to show
+  SlopeScreenWidgets[WIDGET_LEFT_ICON].Value = (Laptop.IsConnected ? 1 : 0) | (Smartphone.IsConnected ? 2 : 0);
+  SlopeScreenWidgets[WIDGET_RIGHT_ICON].Value = Trainer.IsConnected ? 1 : 0;
+  // dtostrf shows 1 decimal: only a change in tenths is a visible change
+  int32_t gradeTenths = (int32_t)lroundf(gradePercentValue * 10);
+  SlopeScreenWidgets[WIDGET_GRADE_FIELD].Value = gradeTenths;
+  // The following calculations give more "weight" to lower grade values
+  // (like: 1.2% or 0.5%), these will occur more often in practice and are not well
+  // displayable at 128*64! --> 64 * 64 = 4096 and this value should not be
+  // exceeded (4096/20) = 204.8
+  int pos = 64 - int(sqrt(abs(204 * gradePercentValue))); // cast to int to get rid of decimals only now!
+  SlopeScreenWidgets[WIDGET_SLOPE_GAUGE].Value = ((64 - pos) << 1) | (gradePercentValue > 0 ? 1 : 0);
+
+  // Determine the dirty region: union of old and new boxes of all changed widgets
+  int16_t dx0 = SCREEN_WIDTH, dy0 = SCREEN_HEIGHT, dx1 = -1, dy1 = -1;
+  for (uint8_t i = 0; i < WIDGET_COUNT; i++) {
+    oled_widget_t *W = &SlopeScreenWidgets[i];
+    if (IsSlopeScreenValid && (W->Value == W->Drawn)) continue;
+    for (uint8_t k = 0; k < 2; k++) { // Box of what was drawn, next of what will be drawn
+      if (i == WIDGET_SLOPE_GAUGE) SetSlopeGaugeBox(W, (k == 0 ? W->Drawn : W->Value));
+      dx0 = min(dx0, W->x); dy0 = min(dy0, W->y);
+      dx1 = max(dx1, (int16_t)(W->x + W->w - 1)); dy1 = max(dy1, (int16_t)(W->y + W->h - 1));
+    }
+  }
+  if (!IsSlopeScreenValid) { // Full redraw
+    dx0 = 0; dy0 = 0; dx1 = SCREEN_WIDTH - 1; dy1 = SCREEN_HEIGHT - 1;
+  }
+  if (dx1 < dx0) return; // Nothing has changed --> no redraw and no flush!
+
+  // Clear and redraw (in z-order) only what falls inside the dirty region
+  display.setClipRect(dx0, dy0, dx1 - dx0 + 1, dy1 - dy0 + 1);
+  display.fillRect(dx0, dy0, dx1 - dx0 + 1, dy1 - dy0 + 1, SSD1306_BLACK);
+  display.setTextColor(SSD1306_WHITE);
+  ShowIconsOnTopBar();
+  display.setCursor(102, 10); //26
+  display.setTextSize(2);
+  display.print(F("%"));
+  char tmp[7];
+  dtostrf(gradeTenths / 10.0, 5, 1, tmp); // show sign only if negative
+  display.setCursor(10, 6); // 22
+  display.setTextSize(3);
+  display.print(tmp);
+  if (gradePercentValue > 0) {
+    display.fillTriangle( 1, 63, 127, 63, 127, pos, SSD1306_INVERSE);
+  } else {
+    display.fillTriangle( 127, 63, 1, 63, 0, pos, SSD1306_INVERSE);
+  }
+  // Draw the baseline to smooth small decimal values and show flat road case
+  display.drawFastHLine(1, 63, 127, SSD1306_WHITE);
+  display.resetClipRect();
+  // Flush only the pages and columns of the dirty region
+  display.displayRegion(dx0, dy0, dx1 - dx0 + 1, dy1 - dy0 + 1);
+#ifdef DEBUG_OLED_WIDGETS
+  DEBUG_PRINTF("Oled update: dirty [%d,%d]-[%d,%d] -> %d of %d bytes flushed\n", dx0, dy0, dx1, dy1, \
+              (dx1 - dx0 + 1) * ((dy1 / 8) - (dy0 / 8) + 1), SCREEN_WIDTH * SCREEN_HEIGHT / 8);
+#endif
+  for (uint8_t i = 0; i < WIDGET_COUNT; i++) {
+    SlopeScreenWidgets[i].Drawn = SlopeScreenWidgets[i].Value;
+  }
+  IsSlopeScreenValid = true;
+} 
+
+void xDisplaySequencer(void *arg) {
+  // The ONLY task that draws on the Oled: timed screens first (in order), then the Road Grade
+  screen_item_t Screen;
+#ifdef DEBUG_RENDER_SCHEDULER
+  unsigned long reportTime = millis();
+#endif
+  while(1) {
+    if (xQueueReceive(xScreenQueue, &Screen, 0) == pdTRUE) {
+      DrawScreenOnOled(&Screen);
+      vTaskDelay(pdMS_TO_TICKS(Screen.Pause)); // Only the display task waits!
+      continue;
+    }
+    uint32_t waitTime = OledScheduler.TimeToNextFrame(millis());
+    if (waitTime == 0) {
+      OledScheduler.BeginFrame();
+      DrawSlopeTriangleOnOled();
+      OledScheduler.EndFrame();
+#ifdef DEBUG_RENDER_SCHEDULER
+      if ((millis() - reportTime) >= 10000) { // Report at most every 10 seconds
+        reportTime = millis();
+        DEBUG_PRINTF("Oled Scheduler: %4.1f FPS | render avg %5.2f max %5.2f ms | %lu requests, %lu dropped\n", \
+                     OledScheduler.GetAchievedFps(), OledScheduler.GetAverageRenderMs(), OledScheduler.GetMaxRenderMs(), \
+                     (unsigned long)OledScheduler.GetRequests(), (unsigned long)OledScheduler.GetDroppedFrames());
+        OledScheduler.ResetStats();
+      }
+#endif
+      continue;
+    }
+    // Sleep until a new screen is queued or requested, or the pending frame is due
+    ulTaskNotifyTake(pdTRUE, (waitTime == RENDER_NOTHING_PENDING) ? portMAX_DELAY : pdMS_TO_TICKS(max(waitTime, (uint32_t)1)));
+    PlannedTaskWoken(TASK_DISPLAY);
+  }
+}
+// ---------------------------------------------------------------------------------
+
+
+// ---------------------------------------------------------------------------------
+#ifdef EMA_ALPHA
+int16_t EMA_TargetPositionFilter(int16_t current_value) {
+  static int16_t exponential_average = current_value;
+
+  exponential_average = int16_t( (EMA_ALPHA * (uint32_t)current_value + (100 - EMA_ALPHA) * (uint32_t)exponential_average) / 100 );
+  return exponential_average;
+}
+#endif
+
+void SetManualGradePercentValue(void) 
+{
+  gradePercentValue = float( (RawgradeValue - 20000 + MEASUREOFFSET) )/100;
+  SetNewActuatorPosition();
+}
+
+void SetNewRawGradeValue(float RoadGrade)
+{
+        // ----- Recalculate to relevant values for this project ------
+        // Take into account the allowed Increase Percentage of the inclination
+        // 100% has no effect, 50% means every increase or decrease is divided by 2
+        // --> the increase or decrease of inclination is in 50% smaller steps...
+        gradePercentValue = RoadGrade;
+        RawgradeValue = (long)(RoadGrade*100) + 20000;
+        RawgradeValue = 20000 + long((RawgradeValue - 20000) * GradeChangeFactor / 100);
+        // in steps of 0.01% and with an offset of -200%
+        // gradeValue     gradePercentValue
+        //     0                 -200%
+        //  19000                 -10%
+        //  20000                   0%
+        //  22000                 +20%
+        //  40000                +200%
+        // -------------------------------------
+        // Take into account the measuring offset
+        RawgradeValue = RawgradeValue - MEASUREOFFSET;
+        // Test for Maximally en Minimally Allowed Raw Grade Values ----------------------------------------
+        if (RawgradeValue < aRGVmin) {
+          RawgradeValue = aRGVmin;  // Do not allow lower values than aRGVmin !!
+        }
+        if (RawgradeValue > aRGVmax) {
+          RawgradeValue = aRGVmax;  // Do not allow values to exceed aRGVmax !!
+        }
+        // --------------------------------------------------------------------------------------------------
+        DEBUG_PRINTF("Set Simcline to Percentage: %02.1f %% RawgradeValue: %05d \n", gradePercentValue, RawgradeValue);
+}
+
+void SetNewActuatorPosition(void) {
+  // Handle mechanical movement i.e. wheel position in accordance with Road Inclination
+  // Map RawgradeValue ranging from 0 to 40.000 on the
+  // TargetPosition (between MINPOSITION and MAXPOSITION) of the Lifter
+  // Notice 22000 is equivalent to +20% incline and 19000 to -10% incline
+  RawgradeValue = constrain(RawgradeValue, RGVMIN, RGVMAX); // Keep values within the safe range
+  TargetPosition = map(RawgradeValue, RGVMIN, RGVMAX, MAXPOSITION, MINPOSITION);
+  // EMA filter for smoothing quickly fluctuating Target Position values see: Zwift Titan Grove
+#ifdef EMA_ALPHA
+  TargetPosition = EMA_TargetPositionFilter(TargetPosition);
+#endif
+  if(IsBasicMotorFunctions) {  
+    xSemaphoreTake(xSemaphore, portMAX_DELAY); 
+    lift.SetTargetPosition(TargetPosition);
+    xSemaphoreGive(xSemaphore);
+#ifdef MOVEMENTDEBUG
+    DEBUG_PRINTF("RawgradeValue: %05d Grade percent: %03.1f%% ", RawgradeValue, gradePercentValue);
+    DEBUG_PRINTF("TargetPosition: %03d\n", TargetPosition, DEC);
+#endif
+  }  
+}
+
+void xControlUpDownMovement(void *arg) {
+  // Check "continuously" the Actuator Position and move Motor Up/Down until target position is reached
+  int OnOffsetAction = 0;
+  const TickType_t xDelay = 110 / portTICK_PERIOD_MS; // Block for 110ms < 10Hz sample rate of VL6180X
+  while(1) {
+    if(xSemaphoreTake(xSemaphore, portMAX_DELAY)) {
+        // BLE channels can interrupt and consequently target position changes on-the-fly !!
+        // We do not want changes in TargetPosition during one of the following actions!!!
+        OnOffsetAction = lift.GetOffsetPosition(); // calculate offset to target and determine action
+        switch (OnOffsetAction)
+            {
+              case 0 :
+                lift.brakeActuator();
+#ifdef MOVEMENTDEBUG
+                DEBUG_PRINTLN(F(" -> Brake"));
+#endif
+                break;
+              case 1 :
+                lift.moveActuatorUp();
+#ifdef MOVEMENTDEBUG
+                DEBUG_PRINTLN(F(" -> Upward"));
+#endif
+                break;
+              case 2 :
+                lift.moveActuatorDown();
+#ifdef MOVEMENTDEBUG
+                DEBUG_PRINTLN(F(" -> Downward"));
+#endif
+                break;
+              case 3 :
+                // Timeout --> OffsetPosition is undetermined --> do nothing and brake
+                lift.brakeActuator();
+#ifdef MOVEMENTDEBUG
+                DEBUG_PRINTLN(F(" -> Timeout"));
+#endif
+                break;
+            } // switch 
+        xSemaphoreGive(xSemaphore);    
+    }      
+    PlannedTaskDue(TASK_CONTROL, xDelay * portTICK_PERIOD_MS * 1000);
+    vTaskDelay(xDelay);
+    PlannedTaskWoken(TASK_CONTROL);
+  } // while
+} // end
+
+void StartPlannedTask(uint8_t Task) {
+  task_plan_t *P = &TaskPlan[Task];
+  if (xTaskCreatePinnedToCore(P->Function, P->Name, P->StackSize, NULL, P->Priority, P->Handle, P->CoreID) != pdPASS) {
+    DEBUG_PRINTF("Task %s could NOT be created!\n", P->Name);
+  }
+}
+
+void NotifyPlannedTask(uint8_t Task) {
+  // Wake the task up, the time until it runs is its scheduling latency
+  task_plan_t *P = &TaskPlan[Task];
+  if (*P->Handle == NULL) return;
+  if (P->WakeDue == 0) P->WakeDue = micros();
+  xTaskNotifyGive(*P->Handle);
+}
+
+void PlannedTaskDue(uint8_t Task, unsigned long Delay) {
+  // Task is going to sleep for Delay us: it is late when it runs after that
+  TaskPlan[Task].WakeDue = micros() + Delay;
+}
+
+void PlannedTaskWoken(uint8_t Task) {
+  // Called by the task itself when it runs again: woken up by a timeout only -> nothing to measure
+  task_plan_t *P = &TaskPlan[Task];
+  unsigned long Due = P->WakeDue;
+  if (Due == 0) return;
+  P->WakeDue = 0;
+  long Latency = (long)(micros() - Due);
+  if (Latency < 0) Latency = 0;
+  P->LatencySum += Latency;
+  P->LatencyCount++;
+  if ((unsigned long)Latency > P->LatencyMax) P->LatencyMax = Latency;
+}
+
+// ----------------------------------------------------------------------------------
+
+void client_HR_Measurement_Notify_Callback(BLERemoteCharacteristic* pBLERemoteCharacteristic, uint8_t* pData, size_t length, bool isNotify) {
+  // Client HR Measurement data is tranferred to the Server (Zwift)
+  // NO TREATMENT OF RESPONSE !!!!!
+  ForwardNotification(FORWARD_HR_MEASUREMENT, pData, length); // Just pass on and process later!
+  // Measurement contains of Flags byte, measurement (8 or 16 bit) and optional fields
+#ifdef DEBUG_HBM
+  uint8_t HRDataLen = (uint8_t)length;
+  uint8_t HRDataBuf[HRDataLen] = {};
+  // Transfer first the contents of data to buffer (array of chars)
+  DEBUG_PRINTF(" -> Client Rec'd Raw Heart Rate Measurement Data: [%d] [%d] [ ", isNotify, length);
+  for (int i = 0; i <  sizeof(HRDataBuf); i++) {
+      HRDataBuf[i] = *pData++;
+      DEBUG_PRINTF("%02X ", HRDataBuf[i], HEX);
+  }
+  DEBUG_PRINTLN("] ");
+  uint8_t offset = 0;
+  uint8_t flags = 0;
+  memcpy(&flags, &HRDataBuf[offset], 1); // Transfer buffer fields to flags variable
+  offset += 1;  // UINT8
+  if(flags & 1) { // 16 bit data value is present flag
+    uint16_t HRMvalue = 0;
+    memcpy(&HRMvalue, &HRDataBuf[offset], 2); // Transfer buffer fields to variable
+    DEBUG_PRINTF("Heart Beats: %d HBM (16)", HRMvalue);
+    offset += 2;  // UINT16 
+  } else { // 8 bit value
+    uint8_t HRMvalue = 0;
+    memcpy(&HRMvalue, &HRDataBuf[offset], 1); // Transfer buffer fields to variable
+    DEBUG_PRINTF("Heart Beats: %d HBM (8)", HRMvalue);
+    offset += 1;  // UINT8     
+  }
+  if(flags & 2) { // sensor
+    DEBUG_PRINT(" Contact is detected: ");
+    if (flags & 4) { DEBUG_PRINT("ON"); } 
+    else { DEBUG_PRINT("OFF"); }
+  } else { DEBUG_PRINT(" Contact is NOT detected!"); }
+  if(flags & 8) { DEBUG_PRINT(" Expended Energy"); }
+  if(flags & 16) { DEBUG_PRINT(" RR interval"); }
+  DEBUG_PRINTLN("");
+#endif
+}
+
+bool client_DeviceInformation_Connect(void)
+{
+    // If Device Information is not found then go on.... NOT FATAL !
+    pRemote_DeviceInformation_Service = pClient_FTMS->getService(UUID16_SVC_DEVICE_INFORMATION);    
+    if ( pRemote_DeviceInformation_Service == nullptr ) {
+      DEBUG_PRINT(F("Device Information Service: NOT Found!\n"));
+      return true;
+    }
+      DEBUG_PRINT(F("Client Device Information Service: Found!\n"));
+      pRemote_DIS_ManufacturerName_Chr = pRemote_DeviceInformation_Service->getCharacteristic(UUID16_CHR_MANUFACTURER_NAME_STRING);  
+      if ( pRemote_DIS_ManufacturerName_Chr != nullptr ) {
+          if(pRemote_DIS_ManufacturerName_Chr->canRead()) {
+            client_DIS_Manufacturer_Str = pRemote_DIS_ManufacturerName_Chr->readValue();
+            server_DIS_ManufacturerName_Chr->setValue(client_DIS_Manufacturer_Str); // Transfer/Update the value to the server side
+            DEBUG_PRINTF(" -> Client Reads Manufacturer Name: [%s]\n", client_DIS_Manufacturer_Str.c_str());
+          }            
+      }     
+      pRemote_DIS_ModelNumber_Chr = pRemote_DeviceInformation_Service->getCharacteristic(UUID16_CHR_MODEL_NUMBER_STRING);       
+      if ( pRemote_DIS_ModelNumber_Chr != nullptr ) {
+          if(pRemote_DIS_ModelNumber_Chr->canRead()) {
+            client_DIS_ModelNumber_Str = pRemote_DIS_ModelNumber_Chr->readValue();
+            server_DIS_ModelNumber_Chr->setValue(client_DIS_ModelNumber_Str); // Transfer/Update the value to the server side
+            DEBUG_PRINTF(" -> Client Reads Model Number:      [%s]\n", client_DIS_ModelNumber_Str.c_str());
+          }
+      }  
+      pRemote_DIS_SerialNumber_Chr = pRemote_DeviceInformation_Service->getCharacteristic(UUID16_CHR_SERIAL_NUMBER_STRING);       
+      if ( pRemote_DIS_SerialNumber_Chr != nullptr ) {
+          if(pRemote_DIS_SerialNumber_Chr->canRead()) {
+            client_DIS_SerialNumber_Str = pRemote_DIS_SerialNumber_Chr->readValue();
+            server_DIS_SerialNumber_Chr->setValue(client_DIS_SerialNumber_Str); // Transfer/Update the value to the server side
+            DEBUG_PRINTF(" -> Client Reads Serial Number:     [%s]\n", client_DIS_SerialNumber_Str.c_str());
+          }
+      }       
+  return true;    
+}
+
+bool client_GenericAccess_Connect(void)
+{
+    // If Generic Access is not found then go on.... NOT FATAL !
+    pRemote_GenericAccess_Service = pClient_FTMS->getService(UUID16_SVC_GENERIC_ACCESS);    
+    if ( pRemote_GenericAccess_Service == nullptr ) {
+      DEBUG_PRINTLN(F("Client Generic Access: NOT Found!"));
+      return true;
+    }
+    DEBUG_PRINTLN("Client Generic Access: Found!");
+    pRemote_GA_DeviceName_Chr = pRemote_GenericAccess_Service->getCharacteristic(UUID16_CHR_DEVICE_NAME);  
+      if ( pRemote_GA_DeviceName_Chr != nullptr ) {
+          if(pRemote_GA_DeviceName_Chr->canRead()) {
+            client_GA_DeviceName_Str = pRemote_GA_DeviceName_Chr->readValue();
+            int RespErr = ble_svc_gap_device_name_set((const char*)client_GA_DeviceName_Str.c_str()); // Transfer/Update the value to the server side    
+            DEBUG_PRINTF(" -> Client Reads Device Name:   [%s]\n", client_GA_DeviceName_Str.c_str());
+          }            
+      }     
+      pRemote_GA_Appearance_Chr = pRemote_GenericAccess_Service->getCharacteristic(UUID16_CHR_APPEARANCE);       
+      if ( pRemote_GA_Appearance_Chr != nullptr ) {
+          if(pRemote_GA_Appearance_Chr->canRead()) {
+            client_GA_Appearance_Value = pRemote_GA_Appearance_Chr->readUInt16();
+            int RespErr = ble_svc_gap_device_appearance_set(client_GA_Appearance_Value); // Transfer/Update the value to the server side
+            DEBUG_PRINTF(" -> Client Reads Appearance:    [%d]\n", client_GA_Appearance_Value);
+          }
+      }     
+    return true;     
+}
+
+void client_CP_Measurement_Notify_Callback(BLERemoteCharacteristic* pBLERemoteCharacteristic, uint8_t* pData, size_t length, bool isNotify) 
+{
+  // Client CP Measurement data is tranferred to the Server
+  // NO TREATMENT OF COMMAND !!!
+  ForwardNotification(FORWARD_CP_MEASUREMENT, pData, length); // Just pass on and process later!
+#ifdef DEBUG_CP_MEASUREMENT
+  uint8_t buffer[length]= {}; 
+  // Transfer first the contents of data to buffer (array of chars)
+  DEBUG_PRINTF(" -> Client Rec'd Raw CP Data: [%d] [%d] [ ", isNotify, length); 
+  for (int i = 0; i < sizeof(buffer); i++) {
+    if ( i <= sizeof(buffer)) {
+      buffer[i] = *pData++;
+      DEBUG_PRINTF("%02X ", buffer[i], HEX);
+    }
+  }
+  DEBUG_PRINT("] ");
+  uint8_t offset = 0;
+  // Get flags field
+  uint16_t flags = 0;
+  memcpy(&flags, &buffer[offset], 2); // Transfer buffer fields to variable
+  offset += 2;  // UINT16
+  // Get Instantaneous Power values UINT16
+  uint16_t PowerValue = 0;
+  memcpy(&PowerValue, &buffer[offset], 2); // Transfer buffer fields to variable
+  offset += 2;  // UINT16
+  DEBUG_PRINTF("Instantaneous Power: %4d\n", PowerValue);
+  // Get the other CP measurement values
+  if ((flags & 1) != 0) {
+    //  Power Balance Present
+    DEBUG_PRINT(" --> Pedal Power Balance!");
+  }
+  if ((flags & 2) != 0) {
+    // Accumulated Torque
+    DEBUG_PRINTLN(" --> Accumulated Torque!");
+  }
+  // etcetera...
+#endif
+} // End cpmc_notify_callback
+
+bool client_CyclingPower_Connect(void)
+{
+    // Obtain a reference to the remote CP service.
+    pRemote_CyclingPower_Service = pClient_FTMS->getService(UUID16_SVC_CYCLING_POWER);
+    if (pRemote_CyclingPower_Service == nullptr) {
+      DEBUG_PRINTLN("Mandatory Cycling Power Service: Not Found!");
+      return false;
+    }
+    DEBUG_PRINTLN("Client_CyclingPower_Service: Found!");
+    pRemote_CP_Measurement_Chr = pRemote_CyclingPower_Service->getCharacteristic(UUID16_CHR_CYCLING_POWER_MEASUREMENT);
+    if (pRemote_CP_Measurement_Chr == nullptr) {
+      DEBUG_PRINTLN("Mandatory client_CP_Measurement_Chr: Not Found!");
+      return false;
+    }
+    DEBUG_PRINTLN("Client_CP_Measurement_Chr: Found!");  
+    if(!pRemote_CP_Measurement_Chr->canNotify()) { // Enabled later by CCCD handle
+      DEBUG_PRINTLN("Mandatory Client_CP_Measurement_Chr: Cannot Notify!");
+      return false;
+    }
+    pRemote_CP_Feature_Chr = pRemote_CyclingPower_Service->getCharacteristic(UUID16_CHR_CYCLING_POWER_FEATURE);
+    if (pRemote_CP_Feature_Chr == nullptr) {
+      DEBUG_PRINTLN("Mandatory Client_CP_Feature_Chr: Not Found!");
+      return false;      
+    }
+    DEBUG_PRINTLN("Client_CP_Feature_Chr: Found!");
+    // Read the value of the characteristic.
+    if(pRemote_CP_Feature_Chr->canRead()) 
+      {
+       // Read 32-bit client_CP_Feature_Chr value
+      client_CP_Feature_Flags = pRemote_CP_Feature_Chr->readUInt32();
+      server_CP_Feature_Chr->setValue(client_CP_Feature_Flags); // Transfer/Update the value to the server side
+#ifdef DEBUG
+      const uint8_t CPFC_FIXED_DATALEN = 4;
+      uint8_t cpfcData[CPFC_FIXED_DATALEN] = {(uint8_t)(client_CP_Feature_Flags & 0xff), (uint8_t)(client_CP_Feature_Flags >> 8), 
+                                          (uint8_t)(client_CP_Feature_Flags >> 16), (uint8_t)(client_CP_Feature_Flags >> 24)};
+      DEBUG_PRINT(" -> Client Reads Raw CP Feature bytes: [4] [ ");
+      for (int i = 0; i < CPFC_FIXED_DATALEN; i++) {
+        if ( i <= sizeof(cpfcData)) {
+        DEBUG_PRINTF("%02X ", cpfcData[i], HEX);
+        }
+      }
+      DEBUG_PRINTLN("] ");
+      for (int i = 0; i < client_CP_Feature_Len; i++) {
+        if ( client_CP_Feature_Flags & (1 << i) ) {
+          DEBUG_PRINTLN(client_CP_Feature_Str[i]);
+        }
+      }
+#endif
+      } // canRead Feature
+    pRemote_CP_Location_Chr = pRemote_CyclingPower_Service->getCharacteristic(UUID16_CHR_SENSOR_LOCATION);
+    if (pRemote_CP_Location_Chr == nullptr) {
+      DEBUG_PRINTLN("Client_CP_Location_Chr: Not Found!");
+    } else {
+      DEBUG_PRINTLN("Client_CP_Location_Chr: Found!");
+      // Read the value of the characteristic.
+      if(pRemote_CP_Location_Chr->canRead()) {
+        client_CP_Location_Value = pRemote_CP_Location_Chr->readUInt8();
+        server_CP_Location_Chr->setValue(&client_CP_Location_Value, 1); // Transfer/Update the value to the server side
+        // CP sensor location value is 8 bit
+#ifdef DEBUG
+        DEBUG_PRINT(" -> Client Reads CP Location Sensor:");
+        if(client_CP_Location_Value <= client_Sensor_Location_Str_Len) 
+          DEBUG_PRINTF(" Loc#: %d %s\n", client_CP_Location_Value, client_Sensor_Location_Str[client_CP_Location_Value]);
+        else 
+          DEBUG_PRINTF(" Loc#: %d \n", client_CP_Location_Value);
+#endif
+      }
+    }
+    return true;    
+}
+
+void client_CSC_Measurement_Notify_Callback(BLERemoteCharacteristic* pBLERemoteCharacteristic, uint8_t* pData, size_t length, bool isNotify)
+{
+  // Client CSC Measurement data is tranferred to the Server
+  // NO TREATMENT OF COMMAND !!!
+  ForwardNotification(FORWARD_CSC_MEASUREMENT, pData, length); // Just pass on and process later!
+#ifdef DEBUG_CSC_MEASUREMENT
+  uint8_t buffer[length]= {}; 
+  // Transfer first the contents of data to buffer (array of chars)
+  DEBUG_PRINTF(" -> Client Rec'd Raw CSC Data: [%d] [%d] [ ", isNotify, length); 
+  for (int i = 0; i < length; i++) {
+    if ( i <= sizeof(buffer)) {
+      buffer[i] = *pData++;
+      DEBUG_PRINTF("%02X ", buffer[i], HEX);
+    }
+  }
+  DEBUG_PRINT("] ");
+  uint8_t offset = 0; 
+  // we define the offset that is to be used when reading the next field
+  // Size of variables (e.g. 2 (16) or 4 bytes (32)) are constants in BluetoothGattCharacteristic
+  // these represent the values you can find in the "Value Fields" table in the "Format" column
+  // Read the Flags field at buffer[0]
+  uint8_t flags = buffer[offset]; 
+  offset += 1; // UINT8 
+  // we have to check the flags' nth bit to see if C1 field exists 
+  if ((flags & 1) != 0) {
+    uint32_t cum_wheel_rev = 0;
+    memcpy(&cum_wheel_rev, &buffer[offset], 4);
+    offset += 4; // UINT32
+    uint16_t last_wheel_event = 0;
+    memcpy(&last_wheel_event, &buffer[offset], 2);
+    offset += 2; // UINT16
+    DEBUG_PRINTF(" Cum. wheel rev.: %d Last wheel event: %d ", cum_wheel_rev, last_wheel_event);
+/* Calculation of speed at the Collector can be derived from the wheel circumference and
+* data in two successive measurements. The Collector calculation can be performed as
+* shown below:
+* Speed = (Difference in two successive Cumulative Wheel Revolution values * Wheel Circumference) 
+*         / (Difference in two successive Last Wheel Event Time values)
+*/
+  }
+  // we have to check the flags' nth bit to see if C2 field exists 
+  if ((flags & 2) != 0) {
+    uint16_t cum_cranks = 0;
+    memcpy(&cum_cranks, &buffer[offset], 2);
+    offset += 2; // UINT16
+    uint16_t last_crank_event = 0;
+    memcpy(&last_crank_event, &buffer[offset], 2);
+    offset += 2; // UINT16
+    DEBUG_PRINTF(" Cum cranks: %d Last crank event: %d", cum_cranks, last_crank_event);
+/* Calculation of cadence at the Collector can be derived from data in two successive
+* measurements. The Collector calculation can be performed as shown below:
+* Cadence = (Difference in two successive Cumulative Crank Revolution values)
+*           / (Difference in two successive Last Crank Event Time values)        
+*/         
+  }
+  // etcetera...
+  DEBUG_PRINTLN();
+#endif
+}
+
+bool client_CyclingSpeedCadence_Connect(void)
+{
+    // Obtain a reference to the remote CSC service.
+    pRemote_CyclingSpeedCadence_Service = pClient_FTMS->getService(UUID16_SVC_CYCLING_SPEED_AND_CADENCE);
+    if (pRemote_CyclingSpeedCadence_Service == nullptr) {
+      DEBUG_PRINTLN("Cycling Speed Cadence Service: Not Found!");
+      return true;
+    }
+    DEBUG_PRINTLN("Client_CyclingSpeedCadence_Service: Found!");
+    pRemote_CSC_Measurement_Chr = pRemote_CyclingSpeedCadence_Service->getCharacteristic(UUID16_CHR_CSC_MEASUREMENT);
+    if (pRemote_CSC_Measurement_Chr == nullptr) {
+      DEBUG_PRINTLN("Mandatory client_CSC_Measurement_Chr: Not Found!");
+      return false;
+    }
+    DEBUG_PRINTLN("Client_CSC_Measurement_Chr: Found!");  
+    if(!pRemote_CSC_Measurement_Chr->canNotify()) { // Enabled later by CCCD handle
+      DEBUG_PRINTLN("Mandatory Client_CSC_Measurement_Chr: Cannot Notify!");
+      return false;
+    }
+    pRemote_CSC_Feature_Chr = pRemote_CyclingSpeedCadence_Service->getCharacteristic(UUID16_CHR_CSC_FEATURE);
+    if (pRemote_CSC_Feature_Chr == nullptr) {
+      DEBUG_PRINTLN("Mandatory Client_CSC_Feature_Chr: Not Found!");
+      return false;      
+    }
+    DEBUG_PRINTLN("Client_CSC_Feature_Chr: Found!");
+    // Read the value of the characteristic.
+    if(pRemote_CSC_Feature_Chr->canRead()) 
+      {
+        // Read 16-bit client_CSC_Feature_Chr value
+        client_CSC_Feature_Flags = pRemote_CSC_Feature_Chr->readUInt16();
+        server_CSC_Feature_Chr->setValue(client_CSC_Feature_Flags); // Transfer/Update the value to the server side
+#ifdef DEBUG
+        uint8_t cscfcData[CSC_FEATURE_FIXED_DATALEN] = { (uint8_t)(client_CSC_Feature_Flags & 0xff), (uint8_t)(client_CSC_Feature_Flags >> 8) }; //  Little Endian Representation
+        DEBUG_PRINTF(" -> Client Reads Raw CSC Feature bytes: [2] [ ");
+        for (int i = 0; i < sizeof(cscfcData); i++) {
+          DEBUG_PRINTF("%02X ", cscfcData[i], HEX);
+        }
+        DEBUG_PRINTLN("] ");
+        for (int i = 0; i < client_CSC_Feature_Len; i++) {
+          if ( (client_CSC_Feature_Flags & (1 << i)) != 0 ) {
+            DEBUG_PRINTLN(client_CSC_Feature_Str[i]);
+            }
+        }
+#endif
+      } // canRead Feature
+     
+    pRemote_CSC_Location_Chr = pRemote_CyclingSpeedCadence_Service->getCharacteristic(UUID16_CHR_SENSOR_LOCATION);
+    if (pRemote_CSC_Location_Chr == nullptr) {
+      DEBUG_PRINTLN("Client_CSC_Location_Chr: Not Found!");
+    } else {
+      DEBUG_PRINTLN("Client_CSC_Location_Chr: Found!");
+      // Read the value of the characteristic.
+      if(pRemote_CSC_Location_Chr->canRead()) {
+        client_CSC_Location_Value = pRemote_CSC_Location_Chr->readUInt8();
+        server_CSC_Location_Chr->setValue(&client_CSC_Location_Value, 1); // Transfer/Update the value to the server side
+        // CSC sensor location value is 8 bit
+#ifdef DEBUG
+        DEBUG_PRINT(" -> Client Reads CSC Location Sensor:");
+        if(client_CSC_Location_Value <= client_Sensor_Location_Str_Len) 
+          DEBUG_PRINTF(" Loc#: %d %s\n", client_CSC_Location_Value, client_Sensor_Location_Str[client_CSC_Location_Value]);
+        else 
+          DEBUG_PRINTF(" Loc#: %d \n", client_CSC_Location_Value);
+#endif
+     }
+    }
+    return true;    
+}
+
+bool client_HeartRate_Connect(void)
+{
+    // Obtain a reference to the remote HRM service.
+    pRemote_HeartRate_Service = pClient_FTMS->getService(UUID16_SVC_HEART_RATE);
+    if (pRemote_HeartRate_Service == nullptr) {
+      DEBUG_PRINTLN("Heart Rate Service: Not Found!");
+      return true;
+    }
+    DEBUG_PRINTLN("Client_HeartRate_Service: Found!");
+    pRemote_HR_Measurement_Chr = pRemote_HeartRate_Service->getCharacteristic(UUID16_CHR_HEART_RATE_MEASUREMENT);
+    if (pRemote_HR_Measurement_Chr == nullptr) {
+      DEBUG_PRINTLN("Mandatory client_HR_Measurement_Chr: Not Found!");
+      return false;
+    }
+    DEBUG_PRINTLN("Client_HR_Measurement_Chr: Found!");  
+    if(!pRemote_HR_Measurement_Chr->canNotify()) { // Enabled later by CCCD handle
+      DEBUG_PRINTLN("Mandatory Client_HR_Measurement_Chr: Cannot Notify!");
+      return false;
+    }
+    pRemote_HR_Location_Chr = pRemote_HeartRate_Service->getCharacteristic(UUID16_CHR_BODY_SENSOR_LOCATION);
+    if (pRemote_HR_Location_Chr == nullptr) {
+      DEBUG_PRINTLN("Client_HR_Location_Chr: Not Found!");
+    } else {
+      DEBUG_PRINTLN("Client_HR_Location_Chr: Found!");
+      // Read the value of the characteristic.
+      if(pRemote_HR_Location_Chr->canRead()) {
+        client_HR_Location_Value = pRemote_HR_Location_Chr->readUInt8();
+        server_HR_Location_Chr->setValue(&client_HR_Location_Value, 1); // Transfer/Update the value to the server side
+        // Body sensor location value is 8 bit
+#ifdef DEBUG
+        const uint8_t body_str_len = 7;
+        const char* body_str[body_str_len] = { "Other", "Chest", "Wrist", "Finger", "Hand", "Ear Lobe", "Foot" };
+        DEBUG_PRINT(" -> Client Reads HR Location Sensor:");
+        if(client_HR_Location_Value <= body_str_len)
+          DEBUG_PRINTF(" Loc#: %d %s\n", client_HR_Location_Value, body_str[client_HR_Location_Value]);
+        else 
+          DEBUG_PRINTF(" Loc#: %d \n", client_HR_Location_Value);
+#endif
+      }
+    }
+    return true;    
+}
+
+void client_FTM_TrainingStatus_Notify_Callback(BLERemoteCharacteristic* pBLERemoteCharacteristic, uint8_t* pData, size_t length, bool isNotify)
+{
+  // Client FTM Training Status data is tranferred to the Server
+  // NO TREATMENT OF COMMAND !!!
+  ForwardNotification(FORWARD_FTM_TRAININGSTATUS, pData, length); // Just pass on and process later!
+#ifdef DEBUG_FTM_TRAININGSTATUS
+  uint8_t SDataLen = (uint8_t)length;
+  uint8_t SDataBuf[SDataLen] = {};
+  // Transfer first the contents of data to buffer (array of chars)
+  DEBUG_PRINTF(" -> Client Rec'd Raw FTM Training Status Data: [%d] [%d] [ ", isNotify, length);
+  for (int i = 0; i <  sizeof(SDataBuf); i++) {
+      SDataBuf[i] = *pData++;
+      DEBUG_PRINTF("%02X ", SDataBuf[i], HEX);
+  }
+  DEBUG_PRINTLN("] ");
+#endif
+}
+
+void client_FTM_Status_Notify_Callback(BLERemoteCharacteristic* pBLERemoteCharacteristic, uint8_t* pData, size_t length, bool isNotify)
+{
+  // Client FTM Status data is tranferred to the Server
+  // NO TREATMENT OF COMMAND !!!
+  ForwardNotification(FORWARD_FTM_STATUS, pData, length); // Just pass on and process later!
+#ifdef DEBUG_FTM_STATUS
+  uint8_t SDataLen = (uint8_t)length;
+  uint8_t SDataBuf[SDataLen] = {};
+  // Transfer first the contents of data to buffer (array of chars)
+  DEBUG_PRINTF(" -> Client Rec'd Raw FTM Machine Status Data: [%d] [%d] [ ", isNotify, length);
+  for (int i = 0; i < sizeof(SDataBuf); i++) {
+      SDataBuf[i] = *pData++;
+      DEBUG_PRINTF("%02X ", SDataBuf[i], HEX);
+  }
+  DEBUG_PRINTLN("] ");
+#endif
+}
+
+void client_FTM_IndoorBikeData_Notify_Callback(BLERemoteCharacteristic* pBLERemoteCharacteristic, uint8_t* pData, size_t length, bool isNotify)
+{
+  // Client FTM Indoor Bike Data is tranferred to the Server
+  // NO TREATMENT OF COMMAND !!!
+  ForwardNotification(FORWARD_FTM_INDOORBIKEDATA, pData, length); // Just pass on and process later!
+#ifdef DEBUG_FTM_INDOORBIKEDATA
+  uint8_t IBDDataLen = (uint8_t)length;
+  uint8_t IBDDataBuf[IBDDataLen] = {};
+  // Transfer first the contents of data to buffer (array of chars)
+  DEBUG_PRINTF(" -> Client Rec'd Raw FTM Indoor Bike Data: [%d] [%d] [ ", isNotify, length);
+  for (int i = 0; i < sizeof(IBDDataBuf); i++) {
+      IBDDataBuf[i] = *pData++;
+      DEBUG_PRINTF("%02X ", IBDDataBuf[i], HEX);
+  }
+  DEBUG_PRINTLN("]");
+#endif
+// Decoding Indoor Bike Data and presenting
+// ---> Buffer Data Length depends on data flagged to be present !!!!
+#ifdef DEBUG_DECODE_IBD
+  uint8_t offset = 0;
+  uint16_t flags = 0;
+  memcpy(&flags, &IBDDataBuf[offset], 2); // Transfer buffer fields to variable
+  offset += 2;  // UINT16
+  if ((flags & 1) == 0) { // Inst. Speed is present (!) if flag (bit 0) is set to 0 (null)
+    //  More Data --> Instantaneous Speed 0.01 
+    uint16_t inst_Speed = 0;
+    memcpy(&inst_Speed, &IBDDataBuf[offset], 2); // Transfer buffer fields to variable
+    DEBUG_PRINTF("Instant. Speed: %d KPH", (inst_Speed/100));
+    offset += 2;  // UINT16 
+    }
+  if ((flags & 2) != 0) { 
+    //  Average Speed 0.01 
+    uint16_t av_Speed = 0;
+    memcpy(&av_Speed, &IBDDataBuf[offset], 2); // Transfer buffer fields to variable
+    DEBUG_PRINTF(" Average Speed: %d KPH", (av_Speed/100));
+    offset += 2;  // UINT16 
+    }
+  if ((flags & 4) != 0) {
+    //  Instantaneous Cadence 0.5
+    uint16_t inst_Cadence = 0;
+    memcpy(&inst_Cadence, &IBDDataBuf[offset], 2); // Transfer buffer fields to variable
+    DEBUG_PRINTF(" Instantaneous Cadence: %d RPM", (inst_Cadence/2));
+    offset += 2;  // UINT16 
+    }
+  if ((flags & 8) != 0) {
+    //  Average Cadence 0.5
+    uint16_t av_Cadence = 0;
+    memcpy(&av_Cadence, &IBDDataBuf[offset], 2); // Transfer buffer fields to variable
+    DEBUG_PRINTF(" Average Cadence: %d RPM", (av_Cadence/2));
+    offset += 2;  // UINT16 
+    }
+  if ((flags & 16) != 0) {
+    //  Total Distance  1
+    // Little endian format, transfer 24 bit to 32 bit variable
+    uint32_t tot_Distance = 0;
+    memcpy(&tot_Distance, &IBDDataBuf[offset], 3); // Transfer buffer fields to variable
+    DEBUG_PRINTF(" Total Distance: %d m", tot_Distance);
+    offset += 3;  // UINT24 16 + 8
+    }
+  if ((flags & 32) != 0) {
+    //  Resistance Level  1
+    uint16_t res_Level = 0;
+    memcpy(&res_Level, &IBDDataBuf[offset], 2); // Transfer buffer fields to variable
+    DEBUG_PRINTF(" Resistance Level: %d ", res_Level);
+    offset += 2;  // UINT16 
+    }
+  if ((flags & 64) != 0) {
+    //  Instantaneous Power 1
+    uint16_t inst_Power = 0;
+    memcpy(&inst_Power, &IBDDataBuf[offset], 2); // Transfer buffer fields to variable
+    DEBUG_PRINTF(" Instantaneous Power: %d Watt", inst_Power);
+    offset += 2;  // UINT16 
+    }
+  if ((flags & 128) != 0) {
+    //  Average Power 1
+    uint16_t av_Power = 0;
+    memcpy(&av_Power, &IBDDataBuf[offset], 2); // Transfer buffer fields to variable
+    DEBUG_PRINTF(" Average Power: %d Watt", av_Power);
+    offset += 2;  // UINT16 
+    }
+  if ((flags & 256) != 0) {
+    //  Expended Energy -> UINT16 UINT16 UINT8
+    // Total Energy UINT16  1
+    uint16_t tot_Energy = 0;
+    memcpy(&tot_Energy, &IBDDataBuf[offset], 2); // Transfer buffer fields to variable
+    DEBUG_PRINTF(" Tot. Energy: %d kCal", tot_Energy);
+    offset += 2;  // UINT16 
+    // Energy per hour UINT16 1
+    uint16_t Energy_hr = 0;
+    memcpy(&Energy_hr, &IBDDataBuf[offset], 2); // Transfer buffer fields to variable
+    DEBUG_PRINTF(" Energy/hr: %d kCal/hr", Energy_hr);
+    offset += 2;  // UINT16 
+    // Energy per minute UINT8  1
+    uint8_t Energy_pm = 0;
+    memcpy(&Energy_pm, &IBDDataBuf[offset], 1); // Transfer buffer fields to variable
+    DEBUG_PRINTF(" Energy/m: %d kCal/m", Energy_pm);
+    offset += 1;  // UINT8 
+    }
+  if ((flags & 512) != 0) {
+    //  Heart Rate  1
+    uint8_t Heart_Rate = 0;
+    memcpy(&Heart_Rate, &IBDDataBuf[offset], 1); // Transfer buffer fields to variable
+    DEBUG_PRINTF(" Heart Rate: %d HBM", Heart_Rate);
+    offset += 1;  // UINT8 
+    }
+  if ((flags & 1024) != 0) {
+    //  Metabolic Equivalent 0.1
+    uint8_t Mets = 0;
+    memcpy(&Mets, &IBDDataBuf[offset], 1); // Transfer buffer fields to variable
+    DEBUG_PRINTF(" Metabolic Equivalent: %d ", Mets/10);
+    offset += 1;  // UINT8 
+    }
+  if ((flags & 2048) != 0) {
+    //  Elapsed Time  1
+    uint16_t elap_time = 0;
+    memcpy(&elap_time, &IBDDataBuf[offset], 2); // Transfer buffer fields to variable
+    DEBUG_PRINTF(" Elapsed time: %d s", elap_time);
+    offset += 2;  // UINT16 
+    }
+  if ((flags & 4096) != 0) {
+    //  Remaining Time  1
+    uint16_t rem_time = 0;
+    memcpy(&rem_time, &IBDDataBuf[offset], 2); // Transfer buffer fields to variable
+    DEBUG_PRINTF(" Remaining time: %d s", rem_time);
+    offset += 2;  // UINT16 
+    }
+  DEBUG_PRINTLN();
+#endif
+}
+
+void client_FTM_ControlPoint_Indicate_Callback(BLERemoteCharacteristic* pBLERemoteCharacteristic, uint8_t* pData, size_t length, bool isNotify)
+{
+  // The receipt of Control Point settings is acknowledged by the trainer: handle it
+  // Send Client's Response message to the Server
+  // NO TREATMENT OF COMMAND !!!
+  if(ControlPointInFlightTime != 0) { // Record enqueue-to-ack latency of the command in flight
+    ControlPointAckLatency.Record(micros() - ControlPointInFlightTime);
+    ControlPointInFlightTime = 0;
+  }
+  client_ControlPoint_Response = true; // Should be set now!    
+  NotifyPlannedTask(TASK_CP_WRITER); // Send the next pending command
+  if((Laptop.IsConnected)) {   
+    server_FTM_ControlPoint_Chr->setValue(pData, length);
+    server_FTM_ControlPoint_Chr->indicate(); // Just pass on and process later!
+  }  
+#ifdef DEBUG_FTM_CONTROLPOINT_RESPONSE
+  uint8_t RespBufferLen = (uint8_t)length;
+  uint8_t RespBuffer[RespBufferLen] = {}; // It is max 6 bytes long
+  // Transfer first the contents of data to buffer (array of chars)
+  DEBUG_PRINTF(" -> Client Rec'd Raw FTM Control Point Response Data: [%d] [%d] [ ", isNotify, length); 
+  for (int i = 0; i < sizeof(RespBuffer); i++) {
+      RespBuffer[i] = *pData++;
+      DEBUG_PRINTF("%02X ", RespBuffer[i], HEX);
+  }
+  DEBUG_PRINTLN("]");
+#endif  
+}
+
+bool client_FitnessMachine_Connect(void)
+{
+    // Obtain a reference to the remote FTMS service.
+    pRemote_FitnessMachine_Service = pClient_FTMS->getService(UUID16_SVC_FITNESS_MACHINE);
+    if (pRemote_FitnessMachine_Service == nullptr) {
+      DEBUG_PRINTLN("Mandatory client_FitnessMachine_Service: Not Found!");
+      return false;
+    }
+    DEBUG_PRINTLN("Client_FitnessMachine_Service: Found!");
+
+    pRemote_FTM_Feature_Chr = pRemote_FitnessMachine_Service->getCharacteristic(UUID16_CHR_FITNESS_MACHINE_FEATURE);
+    if (pRemote_FTM_Feature_Chr == nullptr) {
+      DEBUG_PRINTLN("Mandatory Client_FTM_Feature_Chr: Not Found!");
+      return false;
+    } else {
+      DEBUG_PRINTLN("Client_FTM_Feature_Chr: Found!");
+      // Read the value of the characteristic.
+      if(pRemote_FTM_Feature_Chr->canRead()) {
+        // Read Feature Data
+        client_FTM_Feature_Str = pRemote_FTM_Feature_Chr->readValue();
+        server_FTM_Feature_Chr->setValue(client_FTM_Feature_Str); // Transfer/Update the value to the server side
+#ifdef DEBUG
+        uint8_t* MyPtr = (uint8_t*)client_FTM_Feature_Str.c_str();  // Points to first 4 bytes of std::string     
+        DEBUG_PRINT(" -> Client Reads Raw FTM Feature bytes: [8] [ ");
+        for (int i = 0; i < client_FTM_Feature_Str.length(); i++) {
+          DEBUG_PRINTF("%02X ", client_FTM_Feature_Str[i], HEX);
+        } // for
+        DEBUG_PRINTLN("] ");
+        DEBUG_PRINTLN("- Fitness Machine Features:");
+        // Load 32-bit client_CP_Feature_Chr value
+        uint32_t client_FTM_Feature_Flags_One;
+        memcpy(&client_FTM_Feature_Flags_One, MyPtr, 4);  
+        for (int i = 0; i < client_FTM_Feature_Str_One_Len; i++) {
+          if ( client_FTM_Feature_Flags_One & (1 << i) ) {
+            DEBUG_PRINTLN(client_FTM_Feature_Str_One[i]);
+          }
+        }
+        DEBUG_PRINTLN("- Target Setting Features:");
+        // Load 32-bit client_CP_Feature_Chr value
+        uint32_t client_FTM_Feature_Flags_Two;
+        memcpy(&client_FTM_Feature_Flags_Two, MyPtr+4, 4); // Points to second 4 bytes of std::string
+        for (int i = 0; i < client_FTM_Feature_Str_Two_Len; i++) {
+          if ( client_FTM_Feature_Flags_Two & (1 << i) ) {
+            DEBUG_PRINTLN(client_FTM_Feature_Str_Two[i]);
+          }
+        }
+#endif
+      }
+    } 
+
+    pRemote_FTM_IndoorBikeData_Chr = pRemote_FitnessMachine_Service->getCharacteristic(UUID16_CHR_INDOOR_BIKE_DATA);
+    if (pRemote_FTM_IndoorBikeData_Chr == nullptr) {
+      DEBUG_PRINTLN("Mandatory Client_FTM_IndoorBikeData_Chr: Not Found!");
+      return false; // Mandatory when service is present
+    }
+    DEBUG_PRINTLN("Client_FTM_IndoorBikeData_Chr: Found!");  
+    if(!pRemote_FTM_IndoorBikeData_Chr->canNotify()) { // Enabled later by CCCD handle
+      DEBUG_PRINTLN("Mandatory Client_FTM_IndoorBikeData_Chr: Cannot Notify!");
+      return false; // Mandatory when service is present
+    }
+
+    pRemote_FTM_TrainingStatus_Chr = pRemote_FitnessMachine_Service->getCharacteristic(UUID16_CHR_TRAINING_STATUS);
+    if (pRemote_FTM_TrainingStatus_Chr == nullptr) {
+      DEBUG_PRINTLN("Client_FTM_TrainingStatus_Chr: Not Found!");
+      // NOT Mandatory
+    } else {  
+      DEBUG_PRINTLN("Client_FTM_TrainingStatus_Chr: Found!");  
+      if(!pRemote_FTM_TrainingStatus_Chr->canNotify()) { // Enabled later by CCCD handle
+        DEBUG_PRINTLN("Mandatory Client_FTM_TrainingStatus_Chr: Cannot Notify!");
+        return false; // Mandatory when service is present
+      }
+    }
+
+    pRemote_FTM_SupportedResistanceLevelRange_Chr = pRemote_FitnessMachine_Service->getCharacteristic(UUID16_CHR_SUPPORTED_RESISTANCE_LEVEL_RANGE);
+    if (pRemote_FTM_SupportedResistanceLevelRange_Chr == nullptr) {
+      DEBUG_PRINTLN("Client_FTM_SupportedResistanceLevelRange_Chr: Not Found!");
+    } else {
+      DEBUG_PRINTLN("Client_FTM_SupportedResistanceLevelRange_Chr: Found!");
+      // Read the value of the characteristic.
+      if(pRemote_FTM_SupportedResistanceLevelRange_Chr->canRead()) {
+        // Read Supported Resistance Level Range Data
+        client_FTM_SupportedResistanceLevelRange_Str = pRemote_FTM_SupportedResistanceLevelRange_Chr->readValue();
+        server_FTM_SupportedResistanceLevelRange_Chr->setValue(client_FTM_SupportedResistanceLevelRange_Str); // Transfer/Update the value to the server side
+#ifdef DEBUG
+        DEBUG_PRINT(" -> Client Reads Raw FTM Supported Resistance Level Range bytes: [6] [ ");
+        for (int i = 0; i < client_FTM_SupportedResistanceLevelRange_Str.length(); i++) {
+          DEBUG_PRINTF("%02X ", client_FTM_SupportedResistanceLevelRange_Str[i], HEX);
+        } // for
+      DEBUG_PRINTLN("] ");
+#endif
+      }
+    } 
+
+    pRemote_FTM_SupportedPowerRange_Chr = pRemote_FitnessMachine_Service->getCharacteristic(UUID16_CHR_SUPPORTED_POWER_RANGE);
+    if (pRemote_FTM_SupportedPowerRange_Chr == nullptr) {
+      DEBUG_PRINTLN("Client_FTM_SupportedPowerRange_Chr: Not Found!");
+    } else {
+      DEBUG_PRINTLN("Client_FTM_SupportedPowerRange_Chr: Found!");
+      // Read the value of the characteristic.
+      if(pRemote_FTM_SupportedPowerRange_Chr->canRead()) {
+        // Read Supported Power Range Data
+        client_FTM_SupportedPowerRange_Str = pRemote_FTM_SupportedPowerRange_Chr->readValue();
+        server_FTM_SupportedPowerRange_Chr->setValue(client_FTM_SupportedPowerRange_Str); // Transfer/Update the value to the server side
+#ifdef DEBUG
+        DEBUG_PRINT(" -> Client Reads Raw FTM Supported Power Range bytes: [6] [ ");
+        for (int i = 0; i < client_FTM_SupportedPowerRange_Str.length(); i++) {
+          DEBUG_PRINTF("%02X ", client_FTM_SupportedPowerRange_Str[i], HEX);
+        } // for
+      DEBUG_PRINTLN("] ");
+#endif
+      }
+    }  
+
+    pRemote_FTM_ControlPoint_Chr = pRemote_FitnessMachine_Service->getCharacteristic(UUID16_CHR_FITNESS_MACHINE_CONTROL_POINT);
+    if (pRemote_FTM_ControlPoint_Chr == nullptr) {
+      DEBUG_PRINTLN("Mandatory Client_FTM_ControlPoint_Chr: Not Found!");
+      return false; // Mandatory when service is present
+    }
+    DEBUG_PRINTLN("Client_FTM_ControlPoint_Chr: Found!");
+    if(!pRemote_FTM_ControlPoint_Chr->canIndicate()) { // Enabled later by CCCD handle
+      DEBUG_PRINTLN("Mandatory Client_FTM_ControlPoint_Chr: Cannot Indicate!");
+      return false; // Mandatory when service is present
+    }
+    pRemote_FTM_Status_Chr = pRemote_FitnessMachine_Service->getCharacteristic( UUID16_CHR_FITNESS_MACHINE_STATUS);
+    if (pRemote_FTM_Status_Chr == nullptr) {
+      DEBUG_PRINTLN("Mandatory Client_FTM_Status_Chr: Not Found!");
+      return false; // Mandatory when service is present
+    }
+    DEBUG_PRINTLN("Client_FTM_Status_Chr: Found!");  
+    if(!pRemote_FTM_Status_Chr->canNotify()) { // Enabled later by CCCD handle
+      DEBUG_PRINTLN("Mandatory Client_FTM_Status_Chr: Cannot Notify!");
+      return false; // Mandatory when service is present
+    }
+return true;
+} // end Fitness Machine SVC
+
+// This is NOT really a Callback --> It should have been implemented that way (see for instance Adafruit Bluefruit BLE library), 
+// however, now it is called from loop() ... a poor man's solution!
+uint16_t GetUUID16(BLEUUID &UUID) {
+  return UUID.getNative()->u16.value;
+}
+
+client_chr_t *FindClientCharacteristic(BLERemoteCharacteristic **Chr) {
+  for(uint8_t i = 0; i < CLIENT_CHR_COUNT; i++) {
+    if(ClientCharacteristics[i].Chr == Chr) return &ClientCharacteristics[i];
+  }
+  return NULL;
+}
+
+int client_ReadByUUID_Callback(uint16_t conn_handle, const struct ble_gatt_error *error, struct ble_gatt_attr *attr, void *arg) {
+  if((uint32_t)(uintptr_t)arg != GattRequestSeq) return 0; // Request timed out already
+  if((error->status == 0) && (attr != NULL)) { // One matching attribute, the end is signalled with BLE_HS_EDONE
+    if((GattRequestLength == 0) && (GattRequestData != NULL)) {
+      uint16_t Length = 0;
+      ble_hs_mbuf_to_flat(attr->om, GattRequestData, GattRequestSize, &Length);
+      GattRequestLength = Length;
+    }
+    return 0;
+  }
+  GattRequestStatus = (error->status == BLE_HS_EDONE) ? 0 : error->status;
+  xSemaphoreGive(xGattRequestDone);
+  return 0;
+}
+
+int client_ReadLong_Callback(uint16_t conn_handle, const struct ble_gatt_error *error, struct ble_gatt_attr *attr, void *arg) {
+  if((uint32_t)(uintptr_t)arg != GattRequestSeq) return 0; // Request timed out already
+  if((error->status == 0) && (attr != NULL)) { // One part of the value at attr->offset, the end is signalled with BLE_HS_EDONE
+    uint16_t Length = 0;
+    if(attr->offset < GattRequestSize) {
+      ble_hs_mbuf_to_flat(attr->om, GattRequestData + attr->offset, GattRequestSize - attr->offset, &Length);
+    }
+    GattRequestLength = attr->offset + Length;
+    return 0;
+  }
+  GattRequestStatus = (error->status == BLE_HS_EDONE) ? 0 : error->status;
+  xSemaphoreGive(xGattRequestDone);
+  return 0;
+}
+
+int client_Write_Callback(uint16_t conn_handle, const struct ble_gatt_error *error, struct ble_gatt_attr *attr, void *arg) {
+  if((uint32_t)(uintptr_t)arg != GattRequestSeq) return 0; // Request timed out already
+  GattRequestStatus = error->status;
+  xSemaphoreGive(xGattRequestDone);
+  return 0;
+}
+
+int client_Wait_GattRequest(int rc) {
+  // Called with xGattRequestMutex taken, rc is the result of starting the request
+  if(rc != 0) return rc;
+  if(xSemaphoreTake(xGattRequestDone, pdMS_TO_TICKS(GATT_REQUEST_TIMEOUT)) != pdTRUE) return BLE_HS_ETIMEOUT;
+  return GattRequestStatus;
+}
+
+int client_Read_ByUUID(BLEUUID UUID, uint8_t *Data, uint16_t *Length) {
+  // Read the value of the first attribute of this type in the whole database of the trainer
+  xSemaphoreTake(xGattRequestMutex, portMAX_DELAY);
+  xSemaphoreTake(xGattRequestDone, 0); // Clear a late response
+  GattRequestData = Data;
+  GattRequestSize = *Length;
+  GattRequestLength = 0;
+  uint32_t Seq = ++GattRequestSeq;
+  int rc = client_Wait_GattRequest(ble_gattc_read_by_uuid(Trainer.conn_handle, 1, 0xFFFF, &UUID.getNative()->u, \
+                                                            client_ReadByUUID_Callback, (void*)(uintptr_t)Seq));
+  *Length = GattRequestLength;
+  GattRequestData = NULL;
+  xSemaphoreGive(xGattRequestMutex);
+  return rc;
+}
+
+int client_Read_Handle(uint16_t Handle, uint8_t *Data, uint16_t *Length) {
+  // Read the (long) value of an attribute of the trainer by handle
+  xSemaphoreTake(xGattRequestMutex, portMAX_DELAY);
+  xSemaphoreTake(xGattRequestDone, 0); // Clear a late response
+  GattRequestData = Data;
+  GattRequestSize = *Length;
+  GattRequestLength = 0;
+  uint32_t Seq = ++GattRequestSeq;
+  int rc = client_Wait_GattRequest(ble_gattc_read_long(Trainer.conn_handle, Handle, 0, \
+                                                         client_ReadLong_Callback, (void*)(uintptr_t)Seq));
+  *Length = min((uint16_t)GattRequestLength, GattRequestSize); // The value can be longer than the buffer
+  GattRequestData = NULL;
+  xSemaphoreGive(xGattRequestMutex);
+  return rc;
+}
+
+int client_Write_Handle(uint16_t Handle, const uint8_t *Data, uint16_t Length) {
+  // Write with response to an attribute of the trainer by handle
+  xSemaphoreTake(xGattRequestMutex, portMAX_DELAY);
+  xSemaphoreTake(xGattRequestDone, 0); // Clear a late response
+  uint32_t Seq = ++GattRequestSeq;
+  int rc = client_Wait_GattRequest(ble_gattc_write_flat(Trainer.conn_handle, Handle, Data, Length, \
+                                                          client_Write_Callback, (void*)(uintptr_t)Seq));
+  xSemaphoreGive(xGattRequestMutex);
+  return rc;
+}
+
+int client_GattCache_Event(struct ble_gap_event *event, void *arg) {
+  // Fast path: NimBLE has no remote characteristics to route the trainer's notifications to
+  if(!IsHandleRouting || (event->type != BLE_GAP_EVENT_NOTIFY_RX)) return 0;
+  if(event->notify_rx.conn_handle != Trainer.conn_handle) return 0;
+  for(uint8_t i = 0; i < CLIENT_CHR_COUNT; i++) {
+    client_chr_t *C = &ClientCharacteristics[i];
+    if((C->Callback == NULL) || (C->ValueHandle != event->notify_rx.attr_handle)) continue;
+    static uint8_t Data[PREFERRED_MTU]; // Only called in the NimBLE host task
+    uint16_t Length = 0;
+    ble_hs_mbuf_to_flat(event->notify_rx.om, Data, sizeof(Data), &Length);
+    C->Callback(nullptr, Data, Length, !event->notify_rx.indication);
+    break;
+  }
+  return 0;
+}
+
+void client_Set_Cached_Value(client_chr_t *C, const uint8_t *Data, size_t Length) {
+  // Same as after reading the value in a full discovery: keep it and transfer it to the server side
+  std::string Value((const char*)Data, Length);
+  if(C->Chr == &pRemote_GA_DeviceName_Chr) {
+    client_GA_DeviceName_Str = Value;
+    ble_svc_gap_device_name_set((const char*)client_GA_DeviceName_Str.c_str());
+  } else if((C->Chr == &pRemote_GA_Appearance_Chr) && (Length >= 2)) {
+    client_GA_Appearance_Value = Data[0] | (Data[1] << 8);
+    ble_svc_gap_device_appearance_set(client_GA_Appearance_Value);
+  } else if(C->Chr == &pRemote_DIS_ManufacturerName_Chr) {
+    client_DIS_Manufacturer_Str = Value;
+    server_DIS_ManufacturerName_Chr->setValue(client_DIS_Manufacturer_Str);
+  } else if(C->Chr == &pRemote_DIS_ModelNumber_Chr) {
+    client_DIS_ModelNumber_Str = Value;
+    server_DIS_ModelNumber_Chr->setValue(client_DIS_ModelNumber_Str);
+  } else if(C->Chr == &pRemote_DIS_SerialNumber_Chr) {
+    client_DIS_SerialNumber_Str = Value;
+    server_DIS_SerialNumber_Chr->setValue(client_DIS_SerialNumber_Str);
+  } else if((C->Chr == &pRemote_CP_Feature_Chr) && (Length >= 4)) {
+    memcpy(&client_CP_Feature_Flags, Data, 4);
+    server_CP_Feature_Chr->setValue(client_CP_Feature_Flags);
+  } else if(C->Chr == &pRemote_CP_Location_Chr) {
+    client_CP_Location_Value = Data[0];
+    server_CP_Location_Chr->setValue(&client_CP_Location_Value, 1);
+  } else if((C->Chr == &pRemote_CSC_Feature_Chr) && (Length >= 2)) {
+    memcpy(&client_CSC_Feature_Flags, Data, 2);
+    server_CSC_Feature_Chr->setValue(client_CSC_Feature_Flags);
+  } else if(C->Chr == &pRemote_CSC_Location_Chr) {
+    client_CSC_Location_Value = Data[0];
+    server_CSC_Location_Chr->setValue(&client_CSC_Location_Value, 1);
+  } else if(C->Chr == &pRemote_HR_Location_Chr) {
+    client_HR_Location_Value = Data[0];
+    server_HR_Location_Chr->setValue(&client_HR_Location_Value, 1);
+  } else if(C->Chr == &pRemote_FTM_Feature_Chr) {
+    client_FTM_Feature_Str = Value;
+    server_FTM_Feature_Chr->setValue(client_FTM_Feature_Str);
+  } else if(C->Chr == &pRemote_FTM_SupportedResistanceLevelRange_Chr) {
+    client_FTM_SupportedResistanceLevelRange_Str = Value;
+    server_FTM_SupportedResistanceLevelRange_Chr->setValue(client_FTM_SupportedResistanceLevelRange_Str);
+  } else if(C->Chr == &pRemote_FTM_SupportedPowerRange_Chr) {
+    client_FTM_SupportedPowerRange_Str = Value;
+    server_FTM_SupportedPowerRange_Chr->setValue(client_FTM_SupportedPowerRange_Str);
+  }
+}
+
+bool client_Is_Critical(const client_chr_t *C) {
+  // Needed to ride: FTMS (Control Point) and CP measurement
+  return (C->Service == UUID16_SVC_FITNESS_MACHINE) || (C->Service == UUID16_SVC_CYCLING_POWER);
+}
+
+void client_Set_Handles(void) {
+  // After (a phase of) the discovery: value and CCCD handles for routing by handle and the CCCD writes
+  for(uint8_t i = 0; i < CLIENT_CHR_COUNT; i++) {
+    client_chr_t *C = &ClientCharacteristics[i];
+    BLERemoteCharacteristic *R = *C->Chr;
+    if((R == nullptr) || (C->ValueHandle != 0)) continue; // Not (yet) exposed by this trainer or known already
+    C->CCCDHandle = 0;
+    if(C->Callback != NULL) {
+      BLERemoteDescriptor *D = R->getDescriptor(BLEUUID((uint16_t)0x2902));
+      if(D != nullptr) C->CCCDHandle = D->getHandle();
+    }
+    C->ValueHandle = R->getHandle();
+  }
+}
+
+void client_Save_GattCache(void) {
+  // After the full discovery (both phases): keep the handles and static values of this trainer for the next (re)connect
+  TrainerGattCache.Clear(Trainer.PeerAddress);
+  for(uint8_t i = 0; i < CLIENT_CHR_COUNT; i++) {
+    client_chr_t *C = &ClientCharacteristics[i];
+    BLERemoteCharacteristic *R = *C->Chr;
+    if(R == nullptr) continue; // Not exposed by this trainer
+    std::string Value;
+    if(C->Callback == NULL) Value = R->getValue(); // Last value read
+    TrainerGattCache.Add(GetUUID16(C->Service), GetUUID16(C->Characteristic), C->ValueHandle, C->CCCDHandle, \
+                         (const uint8_t*)Value.data(), Value.length());
+  }
+  uint8_t Hash[GATT_CACHE_HASH_LEN];
+  uint16_t HashLen = sizeof(Hash);
+  bool HasHash = (client_Read_ByUUID(UUID16_CHR_DATABASE_HASH, Hash, &HashLen) == 0) && (HashLen == GATT_CACHE_HASH_LEN);
+  TrainerGattCache.SetHash(HasHash ? Hash : NULL);
+  bool IsSaved = TrainerGattCache.Save();
+  DEBUG_PRINTF("GATT cache: %d characteristics %s, Database Hash: %s\n", TrainerGattCache.GetCount(), \
+              (IsSaved ? "saved" : "NOT saved"), (HasHash ? "Yes" : "No"));
+}
+
+bool client_GattCache_Connect(void) {
+  // Fast path: handles and static values from the cache --> no discovery and no reads
+  if(!TrainerGattCache.Load(Trainer.PeerAddress)) {
+    DEBUG_PRINTLN("GATT cache: None for this trainer --> full discovery!");
+    return false;
+  }
+  uint8_t Hash[GATT_CACHE_HASH_LEN];
+  uint16_t HashLen = sizeof(Hash);
+  bool HasHash = (client_Read_ByUUID(UUID16_CHR_DATABASE_HASH, Hash, &HashLen) == 0) && (HashLen == GATT_CACHE_HASH_LEN);
+  // Without a Database Hash (older trainers) the cache is trusted, a failing CCCD write removes it
+  if(HasHash ? !TrainerGattCache.IsHashEqual(Hash) : TrainerGattCache.HasHash()) {
+    DEBUG_PRINTLN("GATT cache: Database Hash has changed --> full discovery!");
+    TrainerGattCache.Remove(Trainer.PeerAddress);
+    return false;
+  }
+  for(uint8_t i = 0; i < CLIENT_CHR_COUNT; i++) {
+    client_chr_t *C = &ClientCharacteristics[i];
+    const gatt_cache_entry_t *E = TrainerGattCache.Find(GetUUID16(C->Service), GetUUID16(C->Characteristic));
+    if(E == NULL) continue;
+    C->ValueHandle = E->ValueHandle;
+    C->CCCDHandle = E->CCCDHandle;
+    if((C->Callback != NULL) || (E->ValueLength == 0)) continue;
+    if(E->ValueLength <= GATT_CACHE_VALUE_LEN) {
+      client_Set_Cached_Value(C, E->Value, E->ValueLength);
+      continue;
+    }
+    // Too long for the cache (Device Name, DIS strings): read it again by its cached handle
+    static uint8_t Value[BLE_ATT_ATTR_MAX_LEN];
+    uint16_t Length = sizeof(Value);
+    if(client_Read_Handle(E->ValueHandle, Value, &Length) == 0) client_Set_Cached_Value(C, Value, Length);
+    else DEBUG_PRINTF("GATT cache: Reading handle %d failed!\n", E->ValueHandle);
+  }
+  return true;
+}
+
+bool client_Critical_Discovery(void) {
+    DEBUG_PRINTLN("Now checking the critical Client Services and Characteristics!");
+    DEBUG_PRINTLN("If Mandatory Services Fail --> the Client will disconnect!");
+  // Discover only what is needed to ride, getService() discovers one service at a time
+  if( !client_FitnessMachine_Connect() ) {
+    pClient_FTMS->disconnect();
+    return false;    
+  }
+  if( !client_CyclingPower_Connect() ) {
+    pClient_FTMS->disconnect();
+    return false;    
+  }
+  return true;
+}
+
+void client_Discover_Optional(void) {
+  // Background phase: one optional service per call, the trainer is ready for riding already
+  const client_optional_t *O = &OptionalServices[OptionalStep];
+  if(OptionalStep == 0) OptionalStartTime = millis();
+  xSemaphoreTake(xGattRequestMutex, portMAX_DELAY); // ATT: no Control Point write during the discovery requests
+  bool IsValid = O->Discover();
+  xSemaphoreGive(xGattRequestMutex);
+  if(!IsValid) { // Riding goes on without it
+    DEBUG_PRINTF("Optional service [%s] is incomplete --> ignored!\n", O->Service.toString().c_str());
+    for(uint8_t i = 0; i < CLIENT_CHR_COUNT; i++) {
+      if(ClientCharacteristics[i].Service == O->Service) *ClientCharacteristics[i].Chr = nullptr;
+    }
+  }
+  if(++OptionalStep < OPTIONAL_SERVICE_COUNT) return;
+  client_Set_Handles();
+  if(CCCDEnable) client_Set_NotificationIndication(true, true); // Follow the current state of the critical ones
+  client_Save_GattCache();
+  DEBUG_PRINTF("Optional trainer services discovered in the background in %lu ms\n", millis() - OptionalStartTime);
+}
+
+bool client_Connect_Callback(void) {
+    // The Client is created once and reused for every (re)connect: no heap churn per attempt
+    if(pClient_FTMS == nullptr) {
+      pClient_FTMS = BLEDevice::createClient(); 
+      pClient_FTMS->setClientCallbacks(&client_Conn_Callbacks, false);
+    }
+    // Remote characteristics of a previous connection are invalid now
+    IsHandleRouting = false;
+    OptionalStep = OPTIONAL_SERVICE_COUNT;
+    for(uint8_t i = 0; i < CLIENT_CHR_COUNT; i++) {
+      *ClientCharacteristics[i].Chr = nullptr;
+      ClientCharacteristics[i].ValueHandle = ClientCharacteristics[i].CCCDHandle = 0;
+    }
+    unsigned long ConnectTime = millis();
+    SetConnectionState(CONN_CONNECT);
+    // Connect to the FTMS BLE Server: address and type are remembered or just found by the scan
+    pClient_FTMS->setConnectTimeout(IsDirectConnect ? DIRECT_CONNECT_TIMEOUT : SCAN_CONNECT_TIMEOUT);
+    // Trainer.PeerAddress holds the native (little endian) bytes of getNative(), NimBLEAddress(uint8_t[6], type)
+    // expects the reversed esp_bd_addr_t order: build the ble_addr_t (native order) instead
+    ble_addr_t PeerAddress;
+    PeerAddress.type = TrainerAddressType;
+    memcpy(PeerAddress.val, Trainer.PeerAddress, 6);
+    if( !pClient_FTMS->connect(NimBLEAddress(PeerAddress)) ) {
+      DEBUG_PRINTF("Client failed to connect to Trainer (%s)!\n", (IsDirectConnect ? "direct" : "scan"));
+      return false;
+    }
+  SetConnectionState(CONN_DISCOVER);
+  bool IsCached = client_GattCache_Connect();
+  if(IsCached) {
+    DEBUG_PRINTF("Trainer services ready from GATT cache in %lu ms\n", millis() - ConnectTime);
+  } else {
+    if( !client_Critical_Discovery() ) return false;
+    client_Set_Handles();
+    DEBUG_PRINTF("Trainer services ready for riding after critical discovery in %lu ms\n", millis() - ConnectTime);
+  }
+  // Value and CCCD handles are known: notifications are routed by handle
+  IsHandleRouting = true;
+  SetConnectionState(CONN_SUBSCRIBE);
+  IsGattCacheUnverified = false;
+  // When the client/trainer is RECONNECTING we need to enable/indicate all Remote Client Char's again!
+  if(IS_TRAINER_DATA_WANTED) {
+    //Do NOT(!) allow for any possible delay (Regularly this is handled in loop() with EVT_CLIENT_ENABLE)
+    if( !client_Set_All_NotificationIndication(true) ) {
+      if(IsCached) { // Handles of the cache are wrong after all
+        DEBUG_PRINTLN("GATT cache: CCCD write failed --> removed, next connect does a full discovery!");
+        TrainerGattCache.Remove(Trainer.PeerAddress);
+      }
+      pClient_FTMS->disconnect();
+      return false;
+    }
+  } else { // Nobody is listening: the trainer stays silent until EVT_CLIENT_ENABLE
+    CCCDEnable = false; // Optional services follow this state
+    IsGattCacheUnverified = IsCached; // The first CCCD write in loop() checks the cache
+  }
+  // ----------------------------------------------------------------------------------------------
+  Trainer.IsConnected = true;
+  client_ControlPoint_Response = true; // Should be set now!  
+  DEBUG_PRINTF("Client negotiated MTU: [%d] with Trainer\n", pClient_FTMS->getMTU());
+  DEBUG_PRINTF("Trainer connected (%s) in %lu ms\n", (IsDirectConnect ? "direct" : "scan"), millis() - TrainerSearchTime);
+  client_Remember_Trainer();
+  LastRecoverDuration = millis() - RecoverStartTime;
+  DEBUG_PRINTF("Trainer recovered in %lu ms after %lu attempt(s)\n", LastRecoverDuration, RecoverAttempts);
+  RecoverAttempts = 0;
+  RecoverBackoff = RECOVER_BACKOFF_MIN;
+  SetConnectionState(CONN_READY);
+  if(!IsCached) OptionalStep = 0; // loop() discovers the optional services and saves the GATT cache
+return true;
+};
+
+void SetConnectionState(uint8_t State) {
+  unsigned long Now = millis();
+  ConnectionStateDuration[ConnectionState] = Now - ConnectionStateTime;
+  DEBUG_PRINTF("Connection state: %s -> %s after %lu ms\n", ConnectionStateName[ConnectionState], ConnectionStateName[State], \
+              ConnectionStateDuration[ConnectionState]);
+  ConnectionState = State;
+  ConnectionStateTime = Now;
+  ConnectionTransitions++;
+}
+
+void client_Recover(void) {
+  // Trainer lost or connect failed: first directly to the remembered trainer, else scan
+  SetConnectionState(CONN_RECOVER);
+  OptionalStep = OPTIONAL_SERVICE_COUNT; // Discovery of the optional services is abandoned
+  RecoverNextTime = 0;
+  if(RecoverAttempts++ == 0) RecoverStartTime = millis();
+  if(IsRankedPick) client_Restore_Trainer(); // Back to the remembered trainer first
+  if(!client_Direct_Connect()) client_Start_Scanning();
+}
+
+void client_Backoff(void) {
+  // Attempt failed: wait before the next one, the wait doubles up to RECOVER_BACKOFF_MAX
+  SetConnectionState(CONN_RECOVER);
+  DEBUG_PRINTF("Trainer not found (attempt %lu) --> next attempt in %lu ms\n", RecoverAttempts, RecoverBackoff);
+  RecoverNextTime = millis() + RecoverBackoff;
+  if(RecoverNextTime == 0) RecoverNextTime = 1;
+  RecoverBackoff = min(RecoverBackoff * 2, (unsigned long)RECOVER_BACKOFF_MAX);
+}
+
+void client_Scan_Ended(NimBLEScanResults Results) {
+  // Also called by stop() when the trainer is found: then loop() connects instead
+  if(!IsTrainerFound) xEventGroupSetBits(xConnectionEvents, EVT_SCAN_ENDED);
+}
+
+void client_Remember_Trainer(void) {
+  // Write only when changed: flash wear
+  static uint8_t RememberedAddress[6] = {};
+  static uint8_t RememberedType = BLE_ADDR_PUBLIC;
+  static std::string RememberedName;
+  if(IsTrainerRemembered && (memcmp(RememberedAddress, Trainer.PeerAddress, 6) == 0) && \
+     (RememberedType == TrainerAddressType) && (RememberedName == Trainer.PeerName)) return;
+  // A ranked pick is a stand-in only: the user switches trainers by removing TRAINER_FILENAME or setting TRAINERADDRESS
+  if(IsRankedPick && IsTrainerRemembered) {
+    DEBUG_PRINTLN("Ranked Trainer is not remembered --> remembered Trainer is kept!");
+    return;
+  }
+  setTrainerData();
+  memcpy(RememberedAddress, Trainer.PeerAddress, 6);
+  RememberedType = TrainerAddressType;
+  RememberedName = Trainer.PeerName;
+  IsTrainerRemembered = true;
+  IsRankedPick = false; // Nothing was remembered: the pick is the trainer from now on
+}
+
+bool client_Direct_Connect(void) {
+  // Connect to the remembered trainer straight away: no scan and no round trip via loop()
+  if(!IsTrainerRemembered) return false;
+  IsDirectConnect = true;
+  TrainerSearchTime = millis();
+  char fullMacAddress[18] = {}; //
+  ConvertMacAddress(fullMacAddress, Trainer.PeerAddress, false); // true -> Native representation!
+  DEBUG_PRINTF("Client Connects directly to remembered Trainer: [%s] Type: [%d]\n", fullMacAddress, TrainerAddressType);
+  if(client_Connect_Callback()) return true;
+  DEBUG_PRINTLN("Direct connect failed --> Client falls back to scanning!");
+  return false;
+}
+
+/**
+ * Scan for BLE servers that advertise the service we are looking for: the remembered trainer is taken at once,
+ * other trainers are candidates that are ranked at the end of the scan stage.
+ */
+class MyAdvertisedDeviceCallbacks: public BLEAdvertisedDeviceCallbacks {
+/*
+ * Called for each advertising BLE server.
+*/
+  void onResult(BLEAdvertisedDevice* advertisedDevice) {
+    //DEBUG_PRINT("Advertising Device-> ");
+    //DEBUG_PRINTLN(advertisedDevice.toString().c_str());
+    // We have found a server device, now see if it contains the FTMS service we are looking for.
+    if (IsTrainerFound) return; // Scan is stopping
+    if (advertisedDevice->haveServiceUUID() && advertisedDevice->isAdvertisingService(UUID16_SVC_FITNESS_MACHINE)) {
+      NimBLEAddress MyAddress = advertisedDevice->getAddress();
+      uint8_t RemoteAddress[6] = {};
+      memcpy(&RemoteAddress, MyAddress.getNative(), 6);
+      char fullMacAddress[18] = {}; //
+      ConvertMacAddress(fullMacAddress, RemoteAddress, false); // true -> Native representation!
+      // OK Server has FTMS service exposed, now check for right mac adress (any trainer when it is the placeholder)
+      if ( memcmp(RemoteAddress, Trainer.PeerAddress, 6) != 0 ) {
+        if ( !IS_ANY_TRAINER ) {
+          DEBUG_PRINTF("Keep Scanning! Unknown Trainer Mac Address: [%s]\n", fullMacAddress);
+          return;
+        }
+        client_Add_Candidate(advertisedDevice); // Ranked when the scan stage ends
+        return;
+      }
+      DEBUG_PRINTF("Found remembered Trainer: [%s] RSSI: [%d] --> no need to rank!\n", fullMacAddress, advertisedDevice->getRSSI());
+      IsTrainerFound = true;
+      BLEDevice::getScan()->stop();
+      myDevice = advertisedDevice;
+      TrainerAddressType = MyAddress.getType();
+      Trainer.PeerName = advertisedDevice->getName().c_str();
+      /* Connect to the FTMS BLE Server -> Sorry you can't do that here!!! --------------------------------
+      ** pClient_FTMS->connect(myDevice);  NOT ALLOWED TO CALL CONNECT --> CAUSES FATAL ERROR !!!! ???? */  
+      xEventGroupSetBits(xConnectionEvents, EVT_TRAINER_FOUND); // loop() connects immediately
+    } // Found our server
+  } // onResult
+}; // MyAdvertisedDeviceCallbacks
+static MyAdvertisedDeviceCallbacks client_Scan_Callbacks;
+
+void client_Connection_Callbacks::onConnect(BLEClient* pClient) {
+    Trainer.conn_handle = pClient_FTMS->getConnId();
+    uint16_t clientConnectionInterval = pClient_FTMS->getConnInfo().getConnInterval();
+    uint16_t clientConnectionLatency = pClient_FTMS->getConnInfo().getConnLatency();
+    uint16_t clientConnectionSupTimeout = pClient_FTMS->getConnInfo().getConnTimeout();
+    TrainerLink.Connected(Trainer.conn_handle, clientConnectionInterval, clientConnectionLatency, clientConnectionSupTimeout);
+    // Request LE Data Length Extension, the MTU exchange is started by NimBLE on connect
+    pClient_FTMS->setDataLen(PREFERRED_DATA_LEN);
+#ifdef DEBUG
+    DEBUG_PRINT("Client Connection Parameters -> ");
+    uint16_t max_payload = pClient_FTMS->getMTU()-3;
+    //DEBUG_PRINTF("Max Transmission Unit: [%d] ", max_payload);
+    DEBUG_PRINTF("Interval: [%d] ", clientConnectionInterval);
+    DEBUG_PRINTF("Latency: [%d] ", clientConnectionLatency);
+    DEBUG_PRINTF("Supervision Timeout: [%d]\n", clientConnectionSupTimeout);
+    char fullMacAddress[18] = {}; //
+    ConvertMacAddress(fullMacAddress, Trainer.PeerAddress, false); // true -> Native representation!
+    DEBUG_PRINTF("ESP32 Client connected to Server device with Name: [%s] MAC Address: [%s] Handle: [%d] MTU: [%d]\n", \
+                                                          Trainer.PeerName.c_str(), fullMacAddress, Trainer.conn_handle, max_payload); 
+#endif
+    /** We can use the connection handle here to ask for different connection parameters.
+     *  Args: connection handle, min connection interval, max connection interval, latency and supervision timeout.
+     *  Units; Min/Max Intervals: 1.25 millisecond increments --> between: 24 (30 ms) resp. 48 (60 ms)
+     *  Latency: number of intervals allowed to skip. --> keep zero
+     *  Timeout: 10 millisecond increments. --> Try 400 (4000 ms)
+     */ 
+    //pClient_FTMS->updateConnParams(pClient_FTMS->getConnId(), 24, 48, 0, 400);
+    //DEBUG_PRINTLN("Client Updates Connection Parameters -> Min Interval: [24] Max Interval: [48] Latency: [0] Supervision Timeout: [400]");  
+    // --> Connection parameters are requested by ApplyLinkPolicy() in loop()
+};
+
+bool client_Connection_Callbacks::onConnParamsUpdateRequest(BLEClient* pClient, ble_gap_upd_params *params) {
+    DEBUG_PRINTLN("Client Connection Parameter Update Request!");
+    /** Minimum value for connection interval in 1.25ms units */
+    uint16_t clientConnectionMinInterval = params->itvl_min;
+    DEBUG_PRINTF("Min Interval: [%d]\n", clientConnectionMinInterval);
+    /** Maximum value for connection interval in 1.25ms units */
+    uint16_t clientConnectionMaxInterval = params->itvl_max;
+    DEBUG_PRINTF("Max Interval: [%d]\n", clientConnectionMaxInterval);
+    /** Connection latency */
+    uint16_t clientConnectionLatency = params->latency;
+    DEBUG_PRINTF("Latency: [%d]\n", clientConnectionLatency);
+    /** Supervision timeout in 10ms units */
+    uint16_t clientConnectionSupTimeout = params->supervision_timeout;
+    DEBUG_PRINTF("Sup. Timeout: [%d]\n", clientConnectionSupTimeout);
+    /** Minimum length of connection event in 0.625ms units */
+    uint16_t clientMinLenEvent = params->min_ce_len;
+    DEBUG_PRINTF("Min Length Event: [%d]\n", clientMinLenEvent);
+    /** Maximum length of connection event in 0.625ms units */
+    uint16_t clientMaxLenEvent = params->max_ce_len;  
+    DEBUG_PRINTF("Max Length Event: [%d]\n", clientMaxLenEvent);
+    // Accept only when at least as fast as the trainer link policy allows at this moment
+    bool IsAccepted = TrainerLink.IsAcceptable(clientConnectionMinInterval, clientConnectionMaxInterval, \
+                                               clientConnectionLatency, clientConnectionSupTimeout);
+    DEBUG_PRINTF("Trainer link policy [%s] --> Request %s\n", (TrainerLink.IsActive() ? "Active" : "Idle"), (IsAccepted ? "Accepted" : "Rejected"));
+    return IsAccepted;
+};
+
+void client_Connection_Callbacks::onDisconnect(BLEClient* pClient) {
+    Trainer.IsConnected = false;
+    IsHandleRouting = false;
+    TrainerLink.Disconnected();
+    Trainer.conn_handle = BLE_HS_CONN_HANDLE_NONE; 
+    char fullMacAddress[18] = {}; //
+    ConvertMacAddress(fullMacAddress, Trainer.PeerAddress, false); // true -> Native representation!
+    DEBUG_PRINTF("Client Disconnected from Server device with Name: [%s] Mac Address: [%s]!\n",  Trainer.PeerName.c_str(), fullMacAddress); 
+    xEventGroupSetBits(xConnectionEvents, EVT_TRAINER_LOST); // loop() recovers immediately
+    //  It is an option to disconnect also the Server, however NOT necessary!! We choose not!
+    //  if(Laptop.IsConnected) pServer->disconnect(Laptop.conn_handle);
+};
+
+void ApplyLinkPolicy(LinkPolicy *Link) {
+  if(!Link->IsConnected()) return;
+  const conn_params_t *Target = Link->Evaluate(millis());
+  if(Target != NULL) {
+    // Central (trainer link) or peripheral (app link): both are requested with ble_gap_update_params()
+    ble_gap_upd_params Params;
+    Params.itvl_min = Target->MinInterval;
+    Params.itvl_max = Target->MaxInterval;
+    Params.latency = Target->Latency;
+    Params.supervision_timeout = Target->Timeout;
+    Params.min_ce_len = BLE_GAP_INITIAL_CONN_MIN_CE_LEN;
+    Params.max_ce_len = BLE_GAP_INITIAL_CONN_MAX_CE_LEN;
+    int rc = ble_gap_update_params(Link->GetConnHandle(), &Params);
+    DEBUG_PRINTF("%s link policy [%s] Requests -> Interval: [%d-%d] Latency: [%d] Supervision Timeout: [%d] rc: [%d] (#%lu)\n", Link->GetName(), \
+                (Link->IsActive() ? "Active" : "Idle"), Target->MinInterval, Target->MaxInterval, Target->Latency, Target->Timeout, rc, \
+                (unsigned long)Link->GetRenegotiations());
+  }
+  // Log the connection parameters that were actually achieved
+  ble_gap_conn_desc Desc;
+  if(ble_gap_conn_find(Link->GetConnHandle(), &Desc) == 0) {
+    if(Link->SetAchieved(Desc.conn_itvl, Desc.conn_latency, Desc.supervision_timeout)) {
+      DEBUG_PRINTF("%s link Achieved -> Interval: [%d] (%d.%02d ms) Latency: [%d] Supervision Timeout: [%d]\n", Link->GetName(), \
+                  Desc.conn_itvl, (Desc.conn_itvl*125)/100, (Desc.conn_itvl*125)%100, Desc.conn_latency, Desc.supervision_timeout);
+    }
+  }
+}
+
+void client_Start_Scanning(void)
+{
+  // Retrieve a Scanner and set the callback we want to use to be informed when we
+  // have detected a new device.  Specify that we want active scanning and start the
+  // scan to run for ## seconds.
+  if(pBLEScan == nullptr) {
+    pBLEScan = BLEDevice::getScan();
+    pBLEScan->setAdvertisedDeviceCallbacks(&client_Scan_Callbacks);
+    pBLEScan->setActiveScan(true);
+  }
+  pBLEScan->clearResults();   // delete results from BLEScan buffer to release memory
+  // Aggressive when the trainer has just been lost or at boot, duty-cycled when it stays away
+  bool IsFast = (RecoverAttempts <= 1);
+  pBLEScan->setInterval(IsFast ? SCAN_FAST_INTERVAL : SCAN_SLOW_INTERVAL);
+  pBLEScan->setWindow(IsFast ? SCAN_FAST_WINDOW : SCAN_SLOW_WINDOW);
+  portENTER_CRITICAL(&ScanCandidateMux);
+  ScanCandidateCount = 0;
+  portEXIT_CRITICAL(&ScanCandidateMux);
+  IsTrainerFound = false;
+  IsDirectConnect = false;
+  TrainerSearchTime = millis();
+  SetConnectionState(CONN_SCAN);
+   DEBUG_PRINTLN("Client Starts Scanning for Server Device with CPS, CSC and FTMS!");  
+  //pBLEScan->start(5, false); // Scan for 5 seconds only
+  // Scan in the background for one window: EVT_TRAINER_FOUND when found, else EVT_SCAN_ENDED -> backoff
+  pBLEScan->start(RECOVER_SCAN_WINDOW, client_Scan_Ended, false);
+}
+
+void client_Add_Candidate(BLEAdvertisedDevice* advertisedDevice) {
+  // Called in the NimBLE host task for every advertisement of an FTMS trainer during the scan stage
+  NimBLEAddress MyAddress = advertisedDevice->getAddress();
+  int8_t RSSI = advertisedDevice->getRSSI();
+  if (RSSI < SCAN_MIN_RSSI) return;
+  // Collect everything outside of the critical section: getName() allocates
+  uint8_t Services = SCAN_HAS_FTMS;
+  if (advertisedDevice->isAdvertisingService(UUID16_SVC_CYCLING_POWER)) Services |= SCAN_HAS_CP;
+  if (advertisedDevice->isAdvertisingService(UUID16_SVC_CYCLING_SPEED_AND_CADENCE)) Services |= SCAN_HAS_CSC;
+  char Name[sizeof(scan_candidate_t::Name)] = {};
+  bool HasName = advertisedDevice->haveName(); // Scan response
+  if (HasName) strlcpy(Name, advertisedDevice->getName().c_str(), sizeof(Name));
+  portENTER_CRITICAL(&ScanCandidateMux);
+  uint8_t i = 0;
+  for (; i < ScanCandidateCount; i++) {
+    if (memcmp(ScanCandidates[i].Address, MyAddress.getNative(), 6) == 0) break;
+  }
+  if (i < SCAN_MAX_CANDIDATES) { // Else the table is full
+    scan_candidate_t *C = &ScanCandidates[i];
+    if (i == ScanCandidateCount) {
+      memcpy(C->Address, MyAddress.getNative(), 6);
+      C->AddressType = MyAddress.getType();
+      C->Name[0] = 0;
+    }
+    C->RSSI = RSSI;
+    C->Services = Services;
+    if (HasName) memcpy(C->Name, Name, sizeof(C->Name));
+    if (i == ScanCandidateCount) {
+      if (i == 0) ScanRankStartTime = millis();
+      ScanCandidateCount++;
+    }
+  }
+  portEXIT_CRITICAL(&ScanCandidateMux);
+}
+
+int client_Rank_Candidate(const scan_candidate_t *C) {
+  // Service set first (every service weighs more than the whole RSSI range), then the strongest signal
+  int Rank = C->RSSI;
+  for (uint8_t b = 0; b < 3; b++) if (C->Services & (1 << b)) Rank += 100;
+  return Rank;
+}
+
+void client_Select_Candidate(void) {
+  // End of the scan stage: stop scanning and take the best ranked candidate
+  IsTrainerFound = true;
+  pBLEScan->stop();
+  // Rank a snapshot: an advertisement can still be underway in the host task
+  static scan_candidate_t Candidates[SCAN_MAX_CANDIDATES];
+  portENTER_CRITICAL(&ScanCandidateMux);
+  uint8_t Count = ScanCandidateCount;
+  memcpy(Candidates, ScanCandidates, Count * sizeof(scan_candidate_t));
+  portEXIT_CRITICAL(&ScanCandidateMux);
+  scan_candidate_t *Best = &Candidates[0];
+  for (uint8_t i = 0; i < Count; i++) {
+    scan_candidate_t *C = &Candidates[i];
+    char fullMacAddress[18] = {}; //
+    ConvertMacAddress(fullMacAddress, C->Address, false); // true -> Native representation!
+    DEBUG_PRINTF("Candidate Trainer: [%s] [%s] RSSI: [%d] Services: [%02X] Rank: [%d]\n", fullMacAddress, C->Name, C->RSSI, \
+                C->Services, client_Rank_Candidate(C));
+    if (client_Rank_Candidate(C) > client_Rank_Candidate(Best)) Best = C;
+  }
+  DEBUG_PRINTF("Scan stage ranked %d candidate(s) in %lu ms\n", Count, millis() - ScanRankStartTime);
+  memcpy(PreviousTrainerAddress, Trainer.PeerAddress, 6);
+  PreviousTrainerAddressType = TrainerAddressType;
+  PreviousTrainerName = Trainer.PeerName;
+  memcpy(Trainer.PeerAddress, Best->Address, 6);
+  TrainerAddressType = Best->AddressType;
+  Trainer.PeerName = Best->Name;
+  IsRankedPick = true;
+}
+
+void client_Restore_Trainer(void) {
+  // The selected candidate failed to connect: the next attempt starts with the trainer from before the scan
+  memcpy(Trainer.PeerAddress, PreviousTrainerAddress, 6);
+  TrainerAddressType = PreviousTrainerAddressType;
+  Trainer.PeerName = PreviousTrainerName;
+  IsRankedPick = false;
+}
+
+// Handler class for Server Multi Characteristic actions limited to onSubscribe
+void CharacteristicCallbacks::onSubscribe(NimBLECharacteristic* pCharacteristic, ble_gap_conn_desc* desc, uint16_t subValue) {
+          String str = "Central Updated CCCD -->";
+        if(subValue == 0) {
+            str += " Notify/Indicate Disabled for Char:";
+        }else if(subValue == 1) {
+            str += " Notify Enabled for Char:";
+        } else if(subValue == 2) {
+            str += " Indicate Enabled for Char:";
+        } else if(subValue == 3) {
+            str += " Notify & Indicate Enabled for Char:";
+        }
+        DEBUG_PRINTF("%s", str.c_str());
+        str = std::string(pCharacteristic->getUUID()).c_str();
+        DEBUG_PRINTF(" [%s] Conn Handle: [%d]\n", str.c_str(), desc->conn_handle);
+        // Keep the subscription table of the centrals up to date
+        SetCentralSubscription(desc->conn_handle, pCharacteristic, subValue);
+};
+
+void server_startADV(void)
+{
+    // Prepare for advertising
+    /** Optional: set the transmit power, default is 3db */
+#ifdef ESP_PLATFORM
+    NimBLEDevice::setPower(ESP_PWR_LVL_P9); /** +9db */
+#else
+    NimBLEDevice::setPower(9); /** +9db */
+#endif
+    pAdvertising = NimBLEDevice::getAdvertising(); 
+    // Advertising data (max 31 bytes): flags, all 16-bit services, appearance and FTMS service data
+    NimBLEAdvertisementData AdvData;
+    AdvData.setFlags(BLE_HS_ADV_F_DISC_GEN | BLE_HS_ADV_F_BREDR_UNSUP);
+    std::vector<NimBLEUUID> Services16 = { UUID16_SVC_CYCLING_POWER, UUID16_SVC_CYCLING_SPEED_AND_CADENCE, \
+                                           UUID16_SVC_FITNESS_MACHINE, UUID16_SVC_HEART_RATE };
+    AdvData.setCompleteServices16(Services16);
+    AdvData.setAppearance(client_GA_Appearance_Value);
+    DEBUG_PRINTF("Setting Appearance in Advertised data to [%d]\n", client_GA_Appearance_Value);
+    // FTMS Service Data: Flags (Fitness Machine Available) and Fitness Machine Type (Indoor Bike Supported)
+    const uint8_t FTMSServiceData[3] = { 0x01, 0x20, 0x00 };
+    AdvData.setServiceData(UUID16_SVC_FITNESS_MACHINE, std::string((char*)FTMSServiceData, sizeof(FTMSServiceData)));
+    pAdvertising->setAdvertisementData(AdvData);
+    // Scan response: the name and the 128-bit NUS service, so an app identifies the Simcline with one active scan
+    NimBLEAdvertisementData ScanData;
+    ScanData.setName(THISDEVICENAME);
+    ScanData.setCompleteServices(UUID_NUS_SERVICE);
+    pAdvertising->setScanResponseData(ScanData);
+    pAdvertising->setScanResponse(true);
+    // Start Advertising 
+    server_Start_Advertising(true);
+}
+
+void server_Start_Advertising(bool IsFast)
+{
+    // (Re)start advertising with the interval of the phase: NimBLE applies a new interval only at start
+    if (pAdvertising->isAdvertising()) pAdvertising->stop();
+    pAdvertising->setMinInterval(IsFast ? ADV_FAST_MIN_INTERVAL : ADV_SLOW_MIN_INTERVAL);
+    pAdvertising->setMaxInterval(IsFast ? ADV_FAST_MAX_INTERVAL : ADV_SLOW_MAX_INTERVAL);
+    if (IsFast) AdvertisingStartTime = millis();
+    IsAdvertisingFast = IsFast;
+    pAdvertising->start();
+    DEBUG_PRINTF("Server is advertising %s\n", (IsFast ? "fast (20-30 ms)" : "slow (152-211 ms)"));
+}
+
+void server_Connection_Callbacks::onConnect(BLEServer* pServer, ble_gap_conn_desc *desc) {
+    // Get some connection parameters of the peer device.
+    uint16_t serverConnectionHandle = desc->conn_handle;
+    uint16_t serverConnectionInterval = desc->conn_itvl;   // Connection interval   
+    uint16_t serverConnectionLatency = desc->conn_latency; // Connection latency
+    uint16_t serverConnectionSupTimeout = desc->supervision_timeout;   // Connection supervision timeout
+    uint8_t RemoteAddress[6];
+    memcpy(&RemoteAddress, NimBLEAddress(desc->peer_id_addr).getNative(), 6);
+    char fullMacAddress[18] = {}; 
+    ConvertMacAddress(fullMacAddress, RemoteAddress, false); // true -> Native format!
+    LastDiscoveryTime = millis() - AdvertisingStartTime;
+    DEBUG_PRINTF("App found and connected %lu ms after the start of advertising (%s phase)\n", LastDiscoveryTime, \
+                (IsAdvertisingFast ? "fast" : "slow"));
+    // Measure app connect -> all notifications flowing
+    AppConnectTime = millis();
+    FlowSeenChannels = 0;
+    IsFlowPending = true;
+    // Request LE Data Length Extension, the central (app) starts the MTU exchange
+    pServer->setDataLen(serverConnectionHandle, PREFERRED_DATA_LEN);
+    // Every central gets an entry in the subscription table
+    AddCentral(serverConnectionHandle, serverConnectionInterval);
+    DEBUG_PRINTF("Server Connection Parameters -> Interval: [%d] Latency: [%d] Supervision Timeout: [%d]\n",serverConnectionInterval, \
+                                                                  serverConnectionLatency, serverConnectionSupTimeout); 
+    DEBUG_PRINTF("ESP32 Server connected to Client device with MAC Address: [%s] Conn Handle: [%d]\n", fullMacAddress, serverConnectionHandle);    
+    /** We can use the connection handle here to ask for different connection parameters.
+     *  Args: connection handle, min connection interval, max connection interval, latency and supervision timeout.
+     *  Units; Min/Max Intervals: 1.25 millisecond increments --> between: 24 (30 ms) resp. 48 (60 ms)
+     *  Latency: number of intervals allowed to skip. --> keep zero
+     *  Timeout: 10 millisecond increments. --> Try 400 (4000 ms)
+     */ 
+    //pServer->updateConnParams(serverConnectionHandle, 24, 48, 0, 400);
+    //DEBUG_PRINTLN("Server Updates Connection Parameters -> Min Interval: [24] Max Interval: [48] Latency: [0] Supervision Timeout: [400]");  
+    // Who has been exactly connected?
+    // [1] Laptop is connecting
+    if (memcmp(RemoteAddress, Laptop.PeerAddress, 6) == 0 ) { // Check Laptop MAC address
+      // Laptop/PC is connecting !
+      memcpy(&Laptop.PeerAddress, RemoteAddress, 6);     
+      Laptop.conn_handle = serverConnectionHandle;       
+      Laptop.IsConnected = true;
+      AppLink.Connected(serverConnectionHandle, serverConnectionInterval, serverConnectionLatency, serverConnectionSupTimeout);
+      DEBUG_PRINTF("Central (%s/Zwift) has to set CP/CSC/FTMS CCCD Notify/Indicate (enable) and start....\n", Laptop.PeerName.c_str());
+      xEventGroupSetBits(xConnectionEvents, EVT_CLIENT_ENABLE);
+    } else {
+      // [2] Smartphone is connecting
+      Smartphone.conn_handle = serverConnectionHandle;
+      Smartphone.IsConnected = true;
+      memcpy(Smartphone.PeerAddress, RemoteAddress, 6);
+      DEBUG_PRINTF("Central (%s/Simcline App) has to set NUS CCCD 'Notify' (enable) and start....\n", Smartphone.PeerName.c_str());
+    }
+    // The controller stops advertising at a connect: advertise again for the next central (fan-out),
+    // unless all links are in use (one link is kept for the trainer)
+    if ((pServer->getConnectedCount() + 1) < CONFIG_BT_NIMBLE_MAX_CONNECTIONS) {
+      DEBUG_PRINTLN(" --> ESP32 Server is advertising for the next Central!");
+      server_Start_Advertising(true);
+    } else {
+      BLEDevice::stopAdvertising(); // All links are in use
+    }
+    /* Alternative for exclusively connecting to Laptop!!
+    if ( !(memcmp(RemoteAddress, Laptop.PeerAddress, 6) == 0) ) {
+        DEBUG_PRINTLN("ERROR >>> Forced Server Disconnect: Unknown Laptop Mac Address!");      
+        pServer->disconnect(desc->conn_handle);        
+        return; // Failed
+    } 
+    */
+};
+
+void server_Connection_Callbacks::onMTUChange(uint16_t MTU, ble_gap_conn_desc* desc) {
+    DEBUG_PRINTF("Central (%s) updated MTU to: [%u] for connection ID: %u\n", \
+                ((desc->conn_handle == Laptop.conn_handle) ? Laptop.PeerName.c_str() : Smartphone.PeerName.c_str()), MTU, desc->conn_handle);           
+};
+
+void server_Connection_Callbacks::onDisconnect(BLEServer* pServer, ble_gap_conn_desc *desc) {
+    uint32_t count = pServer->getConnectedCount();
+    // Get some Disconnection parameters of the peer device.
+    uint16_t serverConnectionHandle = desc->conn_handle;
+    uint8_t RemoteAddress[6] = {};
+    memcpy(&RemoteAddress, NimBLEAddress(desc->peer_id_addr).getNative(), 6);
+    char fullMacAddress[18] = {}; //
+    ConvertMacAddress(fullMacAddress, RemoteAddress, false); // true -> Native format!
+    RemoveCentral(serverConnectionHandle);
+    if (Laptop.conn_handle == serverConnectionHandle ) { // Laptop/Desktop is disconnected
+      Laptop.conn_handle = BLE_HS_CONN_HANDLE_NONE;
+      Laptop.IsConnected = false;
+      AppLink.Disconnected();
+      DEBUG_PRINTF("ESP32 Server disconnected from Central (%s) Conn handle: [%d] Mac Address: [%s]\n", Laptop.PeerName.c_str(), serverConnectionHandle, fullMacAddress);
+      // Tell the client not to send data, unless another central is still subscribed!
+      if(Trainer.IsConnected && (SubscribedChannels == 0)) xEventGroupSetBits(xConnectionEvents, EVT_CLIENT_DISABLE);
+    }
+    if (Smartphone.conn_handle == serverConnectionHandle ) { // Smartphone is disconnected
+      Smartphone.conn_handle = BLE_HS_CONN_HANDLE_NONE;
+      Smartphone.IsConnected = false;
+      DEBUG_PRINTF("ESP32 Server disconnected from Central (%s) Conn handle: [%d] Mac Address: [%s]\n", Smartphone.PeerName.c_str(), serverConnectionHandle, fullMacAddress);
+    }
+    DEBUG_PRINTLN(" --> ESP32 Server is advertising again!");
+    server_Start_Advertising(true); // Fast: the app is probably reconnecting
+};
+
+void server_setupCPS(void)
+{
+   server_CyclingPower_Service = pServer->createService(UUID16_SVC_CYCLING_POWER);
+    server_CP_Measurement_Chr = server_CyclingPower_Service->createCharacteristic(UUID16_CHR_CYCLING_POWER_MEASUREMENT, 
+                                                                            NIMBLE_PROPERTY::NOTIFY); // Notify only (spec), never read
+    server_CP_Measurement_Chr->setCallbacks(&server_Multi_Chr_Callbacks); //NIMBLE 
+    server_CP_Feature_Chr = server_CyclingPower_Service->createCharacteristic(UUID16_CHR_CYCLING_POWER_FEATURE, 
+                                                                            NIMBLE_PROPERTY::READ);
+    // Set server CP Feature Flags field                                                                            
+    server_CP_Feature_Chr->setValue(client_CP_Feature_Flags);                                                                            
+    server_CP_Location_Chr = server_CyclingPower_Service->createCharacteristic(UUID16_CHR_SENSOR_LOCATION, 
+                                                                            NIMBLE_PROPERTY::READ);
+    // Set server_CP_Location for sensor
+    server_CP_Location_Chr->setValue(&client_CP_Location_Value, 1);
+    server_CyclingPower_Service->start();   
+}
+
+void server_setupCSC(void)
+{
+   server_CyclingSpeedCadence_Service = pServer->createService(UUID16_SVC_CYCLING_SPEED_AND_CADENCE);
+    server_CSC_Measurement_Chr = server_CyclingSpeedCadence_Service->createCharacteristic(UUID16_CHR_CSC_MEASUREMENT, 
+                                                                            NIMBLE_PROPERTY::NOTIFY); // Notify only (spec), never read
+    server_CSC_Measurement_Chr->setCallbacks(&server_Multi_Chr_Callbacks); //NIMBLE 
+    server_CSC_Feature_Chr = server_CyclingSpeedCadence_Service->createCharacteristic(UUID16_CHR_CSC_FEATURE, 
+                                                                            NIMBLE_PROPERTY::READ);
+    // Set server CSC Feature Flags field                                                                            
+    server_CSC_Feature_Chr->setValue(client_CSC_Feature_Flags);                                                                            
+    server_CSC_Location_Chr = server_CyclingSpeedCadence_Service->createCharacteristic(UUID16_CHR_SENSOR_LOCATION, 
+                                                                            NIMBLE_PROPERTY::READ);
+    // Set server_CSC_Location for sensor
+    server_CSC_Location_Chr->setValue(&client_CSC_Location_Value, 1);
+    server_CyclingSpeedCadence_Service->start();    
+}
+
+void CheckNotificationFlow(uint8_t Channel) {
+  // Report when every subscribed sample channel of the trainer has notified since the app connected
+  if(!(FlowSeenChannels & (1 << Channel))) {
+    FlowSeenChannels |= (1 << Channel);
+    DEBUG_PRINTF("App connect -> first %s notification: %lu ms\n", ForwardChannels[Channel].Name, millis() - AppConnectTime);
+  }
+  uint8_t SampleChannels = 0;
+  for(uint8_t i = 0; i < FORWARD_COUNT; i++) {
+    forward_channel_t *F = &ForwardChannels[i];
+    if((F->Policy != FORWARD_PASS_THROUGH) && (FindClientCharacteristic(F->Source)->CCCDHandle != 0)) SampleChannels |= (1 << i);
+  }
+  SampleChannels &= SubscribedChannels;
+  if((FlowSeenChannels & SampleChannels) == SampleChannels) {
+    IsFlowPending = false;
+    DEBUG_PRINTF("App connect -> all notifications flowing: %lu ms\n", millis() - AppConnectTime);
+  }
+}
+
+void ForwardNotification(uint8_t Channel, const uint8_t *pData, size_t length) {
+  // Called in the client notify callbacks: never waits for the app link(s)
+  if(!(SubscribedChannels & (1 << Channel))) return; // Nobody is listening
+  if(IsFlowPending) CheckNotificationFlow(Channel);
+  if(ForwardChannels[Channel].Ring.Push(pData, length)) {
+    NotifyPlannedTask(TASK_FORWARDER);
+  }
+}
+
+central_sub_t *FindCentral(uint16_t conn_handle) {
+  for(uint8_t i = 0; i < MAX_CENTRALS; i++) {
+    if(Centrals[i].conn_handle == conn_handle) return &Centrals[i];
+  }
+  return NULL;
+}
+
+void UpdateSubscribedChannels(void) {
+  uint8_t Channels = 0;
+  for(uint8_t i = 0; i < MAX_CENTRALS; i++) {
+    if(Centrals[i].conn_handle != BLE_HS_CONN_HANDLE_NONE) Channels |= Centrals[i].Subscribed;
+  }
+  SubscribedChannels = Channels;
+}
+
+void AddCentral(uint16_t conn_handle, uint16_t Interval) {
+  xSemaphoreTake(xCentralMutex, portMAX_DELAY);
+  central_sub_t *C = FindCentral(BLE_HS_CONN_HANDLE_NONE);
+  if(C != NULL) {
+    C->conn_handle = conn_handle;
+    C->Subscribed = 0;
+    C->Interval = Interval;
+    C->MTU = BLE_ATT_MTU_DFLT;
+    C->Credits = CENTRAL_MAX_CREDITS;
+    C->CreditTime = micros();
+    C->Sent = C->Dropped = C->Oversize = 0;
+  }
+  xSemaphoreGive(xCentralMutex);
+}
+
+void RemoveCentral(uint16_t conn_handle) {
+  xSemaphoreTake(xCentralMutex, portMAX_DELAY);
+  central_sub_t *C = FindCentral(conn_handle);
+  if(C != NULL) {
+    C->conn_handle = BLE_HS_CONN_HANDLE_NONE;
+    C->Subscribed = 0;
+  }
+  UpdateSubscribedChannels();
+  xSemaphoreGive(xCentralMutex);
+}
+
+void SetCentralSubscription(uint16_t conn_handle, NimBLECharacteristic* pCharacteristic, uint16_t subValue) {
+  for(uint8_t Channel = 0; Channel < FORWARD_COUNT; Channel++) {
+    if(*ForwardChannels[Channel].Chr != pCharacteristic) continue;
+    xSemaphoreTake(xCentralMutex, portMAX_DELAY);
+    central_sub_t *C = FindCentral(conn_handle);
+    if(C != NULL) {
+      if(subValue & 0x01) C->Subscribed |= (1 << Channel);
+        else C->Subscribed &= ~(1 << Channel);
+    }
+    bool IsFirst = (SubscribedChannels == 0);
+    UpdateSubscribedChannels();
+    xSemaphoreGive(xCentralMutex);
+    // The first subscription of any central: make sure the trainer sends its data
+    if(IsFirst && (SubscribedChannels != 0)) xEventGroupSetBits(xConnectionEvents, EVT_CLIENT_ENABLE);
+    return;
+  }
+}
+
+void RefreshCentrals(void) {
+  // Connection interval and MTU of the centrals can change at any moment after connecting
+  xSemaphoreTake(xCentralMutex, portMAX_DELAY);
+  for(uint8_t i = 0; i < MAX_CENTRALS; i++) {
+    if(Centrals[i].conn_handle == BLE_HS_CONN_HANDLE_NONE) continue;
+    ble_gap_conn_desc Desc;
+    if(ble_gap_conn_find(Centrals[i].conn_handle, &Desc) == 0) Centrals[i].Interval = Desc.conn_itvl;
+    uint16_t MTU = ble_att_mtu(Centrals[i].conn_handle);
+    if(MTU != 0) Centrals[i].MTU = MTU;
+  }
+  xSemaphoreGive(xCentralMutex);
+}
+
+bool TakeCentralCredit(central_sub_t *C) {
+  // Refill CENTRAL_PACKETS_PER_EVENT credits per elapsed connection interval
+  unsigned long IntervalMicros = max((unsigned long)C->Interval, 6UL) * 1250;
+  unsigned long Events = (micros() - C->CreditTime) / IntervalMicros;
+  if(Events > 0) {
+    C->Credits = min((unsigned long)CENTRAL_MAX_CREDITS, C->Credits + (Events * CENTRAL_PACKETS_PER_EVENT));
+    C->CreditTime += Events * IntervalMicros;
+  }
+  if(C->Credits == 0) return false;
+  C->Credits--;
+  return true;
+}
+
+uint8_t FanOutNotification(uint8_t Channel, const ring_packet_t *Packet) {
+  // Notify every subscribed central straight from the ring slot, the server attribute is only updated
+  // for Training Status: the other forwarded characteristics are notify-only
+  forward_channel_t *F = &ForwardChannels[Channel];
+  if(Channel == FORWARD_FTM_TRAININGSTATUS) (*F->Chr)->setValue(Packet->Data, Packet->Length); // Read mandatory
+  uint16_t AttrHandle = (*F->Chr)->getHandle();
+  uint8_t Count = 0;
+  xSemaphoreTake(xCentralMutex, portMAX_DELAY);
+  for(uint8_t i = 0; i < MAX_CENTRALS; i++) {
+    central_sub_t *C = &Centrals[i];
+    if((C->conn_handle == BLE_HS_CONN_HANDLE_NONE) || !(C->Subscribed & (1 << Channel))) continue;
+    if(Packet->Length > (C->MTU - 3)) { // Would be truncated --> malformed data for the app
+      C->Oversize++;
+      continue;
+    }
+    // Flow control: a slow central loses samples, it does not stall the others (events are always sent)
+    if((F->Policy != FORWARD_PASS_THROUGH) && !TakeCentralCredit(C)) {
+      C->Dropped++;
+      continue;
+    }
+    os_mbuf *om = ble_hs_mbuf_from_flat(Packet->Data, Packet->Length);
+    if((om == NULL) || (ble_gattc_notify_custom(C->conn_handle, AttrHandle, om) != 0)) {
+      C->Dropped++; // ble_gattc_notify_custom() frees the mbuf in all cases
+      continue;
+    }
+    C->Sent++;
+    Count++;
+  }
+  xSemaphoreGive(xCentralMutex);
+  return Count;
+}
+
+void AveragedFieldOffsets(uint8_t Channel, const ring_packet_t *Packet, uint8_t *Offsets) {
+  // Offset of every averaged (16 bit) field in the sample, 0 -> field not present
+  Offsets[AVERAGE_POWER] = Offsets[AVERAGE_CADENCE] = 0;
+  if(Channel == FORWARD_CP_MEASUREMENT) {
+    Offsets[AVERAGE_POWER] = 2; // Flags (16) -> Instantaneous Power (sint16)
+  } else if((Channel == FORWARD_FTM_INDOORBIKEDATA) && (Packet->Length >= 2)) {
+    uint16_t Flags = Packet->Data[0] | (Packet->Data[1] << 8);
+    uint8_t Offset = 2;
+    if(!(Flags & 0x0001)) Offset += 2; // Instantaneous Speed (More Data bit is 0)
+    if(Flags & 0x0002) Offset += 2;    // Average Speed
+    if(Flags & 0x0004) {               // Instantaneous Cadence (uint16)
+      Offsets[AVERAGE_CADENCE] = Offset;
+      Offset += 2;
+    }
+    if(Flags & 0x0008) Offset += 2;    // Average Cadence
+    if(Flags & 0x0010) Offset += 3;    // Total Distance
+    if(Flags & 0x0020) Offset += 2;    // Resistance Level
+    if(Flags & 0x0040) Offsets[AVERAGE_POWER] = Offset; // Instantaneous Power (sint16)
+  }
+  for(uint8_t Field = 0; Field < AVERAGE_FIELDS; Field++) {
+    if((Offsets[Field] + 2) > Packet->Length) Offsets[Field] = 0;
+  }
+}
+
+int32_t GetAveragedField(uint8_t Field, const uint8_t *Data) {
+  uint16_t Value = Data[0] | (Data[1] << 8);
+  return (Field == AVERAGE_POWER) ? (int32_t)(int16_t)Value : (int32_t)Value;
+}
+
+unsigned long NotifyAirtime(uint16_t Length) {
+  // 1M PHY: 17 bytes LL/L2CAP/ATT overhead at 8 us per byte, an empty ack packet and 2x IFS
+  return ((unsigned long)(Length + 17) * 8) + 380;
+}
+
+void AggregateSample(uint8_t Channel, const ring_packet_t *Packet) {
+  forward_channel_t *F = &ForwardChannels[Channel];
+  if(F->IsPending) { // The pending sample will not be notified on its own
+    F->Saved++;
+    F->AirtimeSaved += NotifyAirtime(F->Pending.Length);
+  }
+  if(F->Policy == FORWARD_AVERAGE) {
+    uint8_t Offsets[AVERAGE_FIELDS];
+    AveragedFieldOffsets(Channel, Packet, Offsets);
+    for(uint8_t Field = 0; Field < AVERAGE_FIELDS; Field++) {
+      if(Offsets[Field] == 0) continue;
+      F->Sum[Field] += GetAveragedField(Field, &Packet->Data[Offsets[Field]]);
+      F->Samples[Field]++;
+    }
+  }
+  F->Pending = *Packet;
+  F->IsPending = true;
+}
+
+void SendAggregate(uint8_t Channel) {
+  // Notify the newest sample, with the averaged fields of the window
+  forward_channel_t *F = &ForwardChannels[Channel];
+  if(F->Policy == FORWARD_AVERAGE) {
+    uint8_t Offsets[AVERAGE_FIELDS];
+    AveragedFieldOffsets(Channel, &F->Pending, Offsets);
+    for(uint8_t Field = 0; Field < AVERAGE_FIELDS; Field++) {
+      if((Offsets[Field] != 0) && (F->Samples[Field] > 0)) {
+        uint16_t Average = (uint16_t)(F->Sum[Field] / (int32_t)F->Samples[Field]);
+        F->Pending.Data[Offsets[Field]] = (uint8_t)(Average & 0xFF);
+        F->Pending.Data[Offsets[Field]+1] = (uint8_t)(Average >> 8);
+      }
+      F->Sum[Field] = 0;
+      F->Samples[Field] = 0;
+    }
+  }
+#ifdef DEBUG_NOTIFY_FORWARDING
+  unsigned long StartTime = micros();
+#endif
+  if(FanOutNotification(Channel, &F->Pending) > 0) {
+    F->Latency.Record(micros() - F->Pending.Timestamp);
+#ifdef DEBUG_NOTIFY_FORWARDING
+    unsigned long Elapsed = micros() - StartTime;
+    ForwardMicrosSum += Elapsed;
+    if(Elapsed > ForwardMicrosMax) ForwardMicrosMax = Elapsed;
+    ForwardPackets++;
+#endif
+  }
+  F->IsPending = false;
+  F->LastSent = millis();
+}
+
+void xNotifyForwarder(void *parameter) {
+#ifdef DEBUG_NOTIFY_FORWARDING
+  unsigned long ReportTime = millis();
+#endif
+#ifdef DEBUG_BRIDGE_LATENCY
+  unsigned long LatencyReportTime = millis();
+#endif
+  unsigned long Wait = 1000;
+  for(;;) {
+    // Wait for new notifications or the next rate limited notification, wake up anyhow to report
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(Wait));
+    PlannedTaskWoken(TASK_FORWARDER);
+    Wait = 1000;
+    for(uint8_t Channel = 0; Channel < FORWARD_COUNT; Channel++) {
+      forward_channel_t *F = &ForwardChannels[Channel];
+      const ring_packet_t *Packet;
+      if(F->Policy != FORWARD_PASS_THROUGH) {
+        // Rate limited: merge every new sample, notify at most once per MinInterval
+        while((Packet = F->Ring.Front()) != NULL) {
+          AggregateSample(Channel, Packet);
+          F->Ring.Pop();
+        }
+        if(!F->IsPending) continue;
+        unsigned long SinceSent = millis() - F->LastSent;
+        if(SinceSent >= F->MinInterval) SendAggregate(Channel);
+        else Wait = min(Wait, (unsigned long)(F->MinInterval - SinceSent));
+        continue;
+      }
+      while((Packet = F->Ring.Front()) != NULL) {
+#ifdef DEBUG_NOTIFY_FORWARDING
+        unsigned long StartTime = micros();
+#endif
+        // Pass-through: no setValue copy in the server attribute and no copy of it in notify
+        if(FanOutNotification(Channel, Packet) > 0) {
+          F->Latency.Record(micros() - Packet->Timestamp);
+#ifdef DEBUG_NOTIFY_FORWARDING
+          unsigned long Elapsed = micros() - StartTime;
+          ForwardMicrosSum += Elapsed;
+          if(Elapsed > ForwardMicrosMax) ForwardMicrosMax = Elapsed;
+          ForwardPackets++;
+#endif
+        }
+        F->Ring.Pop();
+      }
+    }
+#ifdef DEBUG_NOTIFY_FORWARDING
+    if((millis() - ReportTime) >= 10000) {
+      unsigned long Seconds = (millis() - ReportTime) / 1000;
+      ReportTime = millis();
+      for(uint8_t Channel = 0; Channel < FORWARD_COUNT; Channel++) {
+        forward_channel_t *F = &ForwardChannels[Channel];
+        ring_stats_t Stats;
+        F->Ring.TakeStats(&Stats); // Since the previous report, the notify callback keeps counting
+        DEBUG_PRINTF("Forward %-20s pushed: %4lu forwarded: %4lu overflow: %3lu oversize: %3lu max depth: %lu\n", F->Name, \
+                    (unsigned long)Stats.Pushed, (unsigned long)Stats.Forwarded, (unsigned long)Stats.Overflows, \
+                    (unsigned long)Stats.Oversize, (unsigned long)Stats.MaxDepth);
+        if(F->Policy == FORWARD_PASS_THROUGH) continue;
+        DEBUG_PRINTF("Forward %-20s rate limit: %4d ms saved: %lu notify/s airtime: %lu us/s per central\n", F->Name, \
+                    F->MinInterval, F->Saved/Seconds, F->AirtimeSaved/Seconds);
+        F->Saved = F->AirtimeSaved = 0;
+      }
+      DEBUG_PRINTF("Forward notify: %lu packets, avg: %lu us max: %lu us, free heap: %lu min: %lu\n", ForwardPackets, \
+                  (ForwardPackets ? ForwardMicrosSum/ForwardPackets : 0), ForwardMicrosMax, \
+                  (unsigned long)ESP.getFreeHeap(), (unsigned long)ESP.getMinFreeHeap());
+      for(uint8_t i = 0; i < MAX_CENTRALS; i++) {
+        central_sub_t *C = &Centrals[i];
+        if(C->conn_handle == BLE_HS_CONN_HANDLE_NONE) continue;
+        DEBUG_PRINTF("Central [%d] subscribed: %02X interval: %d MTU: %d sent: %lu dropped: %lu oversize: %lu\n", C->conn_handle, \
+                    C->Subscribed, C->Interval, C->MTU, C->Sent, C->Dropped, C->Oversize);
+      }
+      ForwardPackets = ForwardMicrosSum = ForwardMicrosMax = 0;
+    }
+#endif
+#ifdef DEBUG_BRIDGE_LATENCY
+    if((millis() - LatencyReportTime) >= 60000) {
+      LatencyReportTime = millis();
+      ShowBridgeLatency();
+    }
+#endif
+  }
+}
+
+void CoalesceControlPoint(const ftmcp_frame_t *Frame) {
+  uint8_t Slot = Frame->Data[0]; // Opcode
+  if(Slot >= CONTROL_POINT_PENDING_SLOTS) Slot = CONTROL_POINT_PENDING_SLOTS-1;
+  if(ControlPointPendingSeq[Slot] != 0) ControlPointCoalesced++; // Latest wins: stale value is overwritten
+  ControlPointPending[Slot] = *Frame;
+  ControlPointPendingSeq[Slot] = ++ControlPointSeq;
+}
+
+int8_t OldestPendingControlPoint(void) {
+  int8_t Oldest = -1;
+  for(uint8_t Slot = 0; Slot < CONTROL_POINT_PENDING_SLOTS; Slot++) {
+    if(ControlPointPendingSeq[Slot] == 0) continue;
+    if((Oldest < 0) || (ControlPointPendingSeq[Slot] < ControlPointPendingSeq[Oldest])) Oldest = Slot;
+  }
+  return Oldest;
+}
+
+void RequeueControlPoint(void) {
+  // Put the failed command back with its original arrival order, unless a newer one of the same opcode arrived
+  uint8_t Slot = ControlPointInFlight.Data[0];
+  if(Slot >= CONTROL_POINT_PENDING_SLOTS) Slot = CONTROL_POINT_PENDING_SLOTS-1;
+  if(ControlPointPendingSeq[Slot] != 0) return;
+  ControlPointPending[Slot] = ControlPointInFlight;
+  ControlPointPendingSeq[Slot] = ControlPointInFlightSeq;
+}
+
+void ControlPointFailed(void) {
+  ControlPointInFlightTime = 0;
+  RequeueControlPoint();
+  if(++ControlPointFailures >= CONTROL_POINT_MAX_FAILURES) {
+    // Escalate: the trainer is not responding --> disconnect, the command is sent after reconnect
+    ControlPointEscalations++;
+    ControlPointFailures = 0;
+    ControlPointState = CP_IDLE;
+    DEBUG_PRINTLN(">>> Error: NOT responding to FTM Control Point -> Write Value!");
+    pClient_FTMS->disconnect();
+    return;
+  }
+  ControlPointRetries++;
+  ControlPointState = CP_RETRY_WAIT;
+  ControlPointDeadline = millis() + (CONTROL_POINT_RETRY_DELAY*ControlPointFailures) + random(CONTROL_POINT_RETRY_JITTER);
+}
+
+void SendControlPoint(int8_t Slot) {
+  ControlPointInFlight = ControlPointPending[Slot];
+  ControlPointInFlightSeq = ControlPointPendingSeq[Slot];
+  ControlPointPendingSeq[Slot] = 0;
+  client_ControlPoint_Response = false;
+  ControlPointInFlightTime = ControlPointInFlight.EnqueueTime;
+  ControlPointWrites++;
+  unsigned long WriteTime = micros();
+  ControlPointQueueLatency.Record(WriteTime - ControlPointInFlight.EnqueueTime);
+  // Just pass on and process later! 
+  bool IsWritten = (client_Write_Handle(FindClientCharacteristic(&pRemote_FTM_ControlPoint_Chr)->ValueHandle, \
+                                       ControlPointInFlight.Data, ControlPointInFlight.Length) == 0); // WithResponse
+  ControlPointWriteLatency.Record(micros() - WriteTime);
+  if( !IsWritten ) {
+    ControlPointWriteErrors++;
+    ControlPointFailed();
+    return;
+  }
+  ControlPointState = CP_AWAIT_ACK;
+  ControlPointDeadline = millis() + CONTROL_POINT_ACK_TIMEOUT;
+}
+
+void xControlPointWriter(void *parameter) {
+  ftmcp_frame_t Frame;
+#ifdef DEBUG_CONTROLPOINT_LATENCY
+  unsigned long ReportTime = millis();
+#endif
+  for(;;) {
+    // Wait for a new command, the trainer's ack or the expiry of the ack wait/retry delay
+    TickType_t Wait = pdMS_TO_TICKS(CONTROL_POINT_WRITER_WAIT);
+    if(ControlPointState != CP_IDLE) {
+      long Remaining = (long)(ControlPointDeadline - millis());
+      Wait = (Remaining <= 0) ? 0 : min(Wait, pdMS_TO_TICKS(Remaining));
+    }
+    ulTaskNotifyTake(pdTRUE, Wait);
+    PlannedTaskWoken(TASK_CP_WRITER);
+    while(xQueueReceive(xControlPointQueue, &Frame, 0) == pdTRUE) {
+      CoalesceControlPoint(&Frame);
+    }
+    bool IsExpired = ((long)(millis() - ControlPointDeadline) >= 0);
+    if(!Trainer.IsConnected) {
+      // Trainer dropped out: keep the command for after the reconnect
+      if(ControlPointState != CP_IDLE) RequeueControlPoint();
+      ControlPointState = CP_IDLE;
+      ControlPointFailures = 0;
+    } else if(ControlPointState == CP_AWAIT_ACK) {
+      if(client_ControlPoint_Response) { // Acknowledged
+        ControlPointState = CP_IDLE;
+        ControlPointFailures = 0;
+      } else if(IsExpired) {
+        ControlPointAckTimeouts++;
+        ControlPointFailed();
+      }
+    } else if((ControlPointState == CP_RETRY_WAIT) && IsExpired) {
+      ControlPointState = CP_IDLE;
+    }
+    // Send the oldest pending command only when the previous one has been acknowledged
+    int8_t Slot = OldestPendingControlPoint();
+    if((Slot >= 0) && Trainer.IsConnected && (ControlPointState == CP_IDLE)) {
+      SendControlPoint(Slot);
+    }
+#ifdef DEBUG_CONTROLPOINT_LATENCY
+    if((millis() - ReportTime) >= 10000) {
+      ReportTime = millis();
+      DEBUG_PRINTF("Control Point: %lu acks, latency avg: %lu us max: %lu us, coalesced: %lu, queue full: %lu\n", \
+                  (unsigned long)ControlPointAckLatency.GetCount(), (unsigned long)ControlPointAckLatency.GetAverage(), \
+                  (unsigned long)ControlPointAckLatency.GetMax(), ControlPointCoalesced, ControlPointQueueFull);
+      DEBUG_PRINTF("Control Point: %lu writes, write errors: %lu, ack timeouts: %lu, retries: %lu, escalations: %lu\n", ControlPointWrites, \
+                  ControlPointWriteErrors, ControlPointAckTimeouts, ControlPointRetries, ControlPointEscalations);
+      ControlPointCoalesced = ControlPointQueueFull = 0;
+    }
+#endif
+  }
+};
+
+uint8_t GetServerValue(NimBLECharacteristic *pCharacteristic, uint8_t *Data) {
+  // Copy of the written value into Data, that holds SERVER_VALUE_MAXLEN bytes: never more than the value's real length.
+  // No NimBLEAttValue copy (heap allocation per write): the value buffer is read in place under the attribute's lock,
+  // it holds at least CONFIG_NIMBLE_CPP_ATT_VALUE_INIT_LENGTH bytes. Writes are handled in the host task: no write in between
+  time_t Timestamp; // Passing it makes NimBLE take the lock
+  size_t Length = min(pCharacteristic->getDataLength(), (size_t)SERVER_VALUE_MAXLEN);
+  server_value_t Value = pCharacteristic->getValue<server_value_t>(&Timestamp, true); // true -> value may be shorter
+  memcpy(Data, Value.Bytes, Length);
+  return (uint8_t)Length;
+}
+
+class server_FTM_ControlPoint_Chr_callback: public BLECharacteristicCallbacks {
+void onWrite(BLECharacteristic *pCharacteristic) {
+  uint8_t ftmcpData[SERVER_VALUE_MAXLEN];
+  uint8_t ftmcpDataLen = GetServerValue(server_FTM_ControlPoint_Chr, ftmcpData);
+  if(ftmcpDataLen == 0) return; // No opcode
+  // Control Point traffic: keep both links fast
+  AppLink.Activity();
+  TrainerLink.Activity();
+  if(ftmcpDataLen > FTM_CONTROL_POINT_DATALEN) ftmcpDataLen = FTM_CONTROL_POINT_DATALEN;
+  // Server FTM Control Point data is tranferred to the Client
+  // NO TREATMENT OF COMMAND !!!
+  // Queue it for the Control Point Writer task that writes with response to the trainer,
+  // when out of write-response-synch it is kept (newest per opcode) until the trainer's ack
+  if(Trainer.IsConnected) { 
+    ftmcp_frame_t Frame;
+    Frame.Length = ftmcpDataLen;
+    memcpy(Frame.Data, ftmcpData, ftmcpDataLen);
+    Frame.EnqueueTime = micros();
+    if(xQueueSend(xControlPointQueue, &Frame, 0) == pdTRUE) {
+      NotifyPlannedTask(TASK_CP_WRITER);
+    } else {
+      ControlPointQueueFull++;
+      DEBUG_PRINTLN("-> Server Rec'd Raw Control Point Data --> SKIPPED: Queue full!");
+    }
+  } 
+  memset(server_FTM_Control_Point_Data.bytes, 0, sizeof(server_FTM_Control_Point_Data.bytes));
+  // Display the raw request packet
+  // Transfer the contents of data to server_FTM_Control_Point_Data.bytes
+  for (int i = 0; i < ftmcpDataLen; i++) {
+      server_FTM_Control_Point_Data.bytes[i] = ftmcpData[i];
+  }
+#ifdef DEBUG_FTM_CONTROLPOINT_OPCODE_DATA  
+  /// Decodes an incoming Fitness Machine Control Point request
+  DEBUG_PRINTF(" --> Raw FTM Control Point Data [len: %d] ", ftmcpDataLen);
+  DEBUG_PRINTF("[OpCode: %02X] [Values: ", server_FTM_Control_Point_Data.values.OPCODE, HEX);
+  for (int i=0; i<ftmcpDataLen; i++) { 
+    DEBUG_PRINTF("%02X ", server_FTM_Control_Point_Data.values.OCTETS[i], HEX); 
+  }
+  DEBUG_PRINTLN("]");
+#endif    
+    switch(server_FTM_Control_Point_Data.values.OPCODE) {
+#ifdef DEBUG_FTM_CONTROLPOINT_OPCODE_DATA
+    case ftmcpRequestControl: {
+      DEBUG_PRINTLN("Request Control of Machine!");
+      break;
+    }
+    case ftmcpStartOrResume: {
+      DEBUG_PRINTLN("Start or Resume Machine!");
+      break;
+    }
+    case ftmcpStopOrPause: {
+      DEBUG_PRINTLN("Stop or Pause Machine, Parameter: Stop!");
+      break;
+    }
+    case ftmcpReset: {
+      DEBUG_PRINTLN("Reset Machine!");
+      break;
+    }
+#endif
+
+    case ftmcpSetIndoorBikeSimulationParameters: {
+#ifdef DEBUG_FTM_CONTROLPOINT_OPCODE_DATA
+      // Short is 16 bit signed, so the windspeed is converted from two bytes to signed value. Highest bit is sign bit
+      short ws = (server_FTM_Control_Point_Data.values.OCTETS[0] << 8) + server_FTM_Control_Point_Data.values.OCTETS[1]; 
+      wind_speed = ws / 1000.0;
+#endif
+      // Short is 16 bit signed, so a negative grade is correctly converted from two bytes to signed value. Highest bit is sign bit
+      short gr = (server_FTM_Control_Point_Data.values.OCTETS[3] << 8) + server_FTM_Control_Point_Data.values.OCTETS[2]; 
+      grade = (float)(gr/100.0);
+#ifdef DEBUG_FTM_CONTROLPOINT_OPCODE_DATA
+      crr = server_FTM_Control_Point_Data.values.OCTETS[4] / 10000.0;
+      cw = server_FTM_Control_Point_Data.values.OCTETS[5] / 100.0;
+      // Remember, if debugging with Zwift, that these values are divided by 2 if in normal 50% settings!
+      DEBUG_PRINTLN("Set Indoor Bike Simulation Parameters!");
+      DEBUG_PRINT("Wind speed (1000): "); DEBUG_PRINT(wind_speed);
+      DEBUG_PRINT(" | Grade (100): "); DEBUG_PRINT(grade);
+      DEBUG_PRINT(" | Crr (10000): "); DEBUG_PRINT(crr);
+      DEBUG_PRINT(" | Cw (100): "); DEBUG_PRINTLN(cw);
+#endif
+      SetNewRawGradeValue(grade);
+      SetNewActuatorPosition();
+      ShowSlopeTriangleOnOled();  
+      break;
+    }
+    case ftmcpSetTargetResistanceLevel:
+    case ftmcpSetTargetSpeed:
+    case ftmcpSetTargetInclination:
+    case ftmcpSetTargetPower:
+    case ftmcpSetTargetHeartRate:
+    case ftmcpSetTargetedExpendedEngery:
+    case ftmcpSetTargetedNumberOfSteps:
+    case ftmcpSetTargetedNumberOfStrided:
+    case ftmcpSetTargetedDistance:
+    case ftmcpSetTargetedTrainingTime:
+    case ftmcpSetTargetedTimeInTwoHeartRateZones:
+    case ftmcpSetTargetedTimeInThreeHeartRateZones:
+    case ftmcpSetTargetedTimeInFiveHeartRateZones:
+    case ftmcpSetWheelCircumference:
+    case ftmcpSetSpinDownControl:
+    case ftmcpSetTargetedCadence: {
+#ifdef DEBUG_FTM_CONTROLPOINT_OPCODE_DATA      
+      DEBUG_PRINTLN("Unresolved OpCode!");
+#endif
+      break;
+      }
+    } // switch
+  } // onWrite
+  
+  void onSubscribe(NimBLECharacteristic* pCharacteristic, ble_gap_conn_desc* desc, uint16_t subValue) {
+        String str = "Central Updated CCCD -->";
+        if(subValue == 0) {
+            str += " Notify/Indicate Disabled for Char:";
+        }else if(subValue == 1) {
+            str += " Notify Enabled for Char:";
+        } else if(subValue == 2) {
+            str += " Indicate Enabled for Char:";
+        } else if(subValue == 3) {
+            str += " Notify & Indicate Enabled for Char:";
+        }
+        DEBUG_PRINTF("%s", str.c_str());
+        str = std::string(pCharacteristic->getUUID()).c_str();
+        DEBUG_PRINTF(" [%s]\n", str.c_str());
+  }; // onSubscribe
+
+};
+static server_FTM_ControlPoint_Chr_callback server_FTM_ControlPoint_Chr_Callbacks;
+
+void server_setupFTMS(void)
+{   
+    server_FitnessMachine_Service = pServer->createService(UUID16_SVC_FITNESS_MACHINE);
+    server_FTM_Feature_Chr = server_FitnessMachine_Service->createCharacteristic(UUID16_CHR_FITNESS_MACHINE_FEATURE, 
+                                                                            NIMBLE_PROPERTY::READ);
+    server_FTM_Feature_Chr->setValue(client_FTM_Feature_Str);
+
+     server_FTM_Status_Chr = server_FitnessMachine_Service->createCharacteristic(UUID16_CHR_FITNESS_MACHINE_STATUS, 
+                                                                            NIMBLE_PROPERTY::NOTIFY); // Notify only (spec), never read
+    server_FTM_Status_Chr->setCallbacks(&server_Multi_Chr_Callbacks); //NIMBLE    
+    server_FTM_IndoorBikeData_Chr = server_FitnessMachine_Service->createCharacteristic(UUID16_CHR_INDOOR_BIKE_DATA, 
+                                                                            NIMBLE_PROPERTY::NOTIFY); // Notify only (spec), never read
+    server_FTM_IndoorBikeData_Chr->setCallbacks(&server_Multi_Chr_Callbacks); //NIMBLE                                                                                                                                                           
+    server_FTM_SupportedResistanceLevelRange_Chr = server_FitnessMachine_Service->createCharacteristic(UUID16_CHR_SUPPORTED_RESISTANCE_LEVEL_RANGE, 
+                                                                            NIMBLE_PROPERTY::READ); 
+    server_FTM_SupportedResistanceLevelRange_Chr->setValue(client_FTM_SupportedResistanceLevelRange_Str);
+                                                                                 
+    server_FTM_SupportedPowerRange_Chr = server_FitnessMachine_Service->createCharacteristic(UUID16_CHR_SUPPORTED_POWER_RANGE, 
+                                                                            NIMBLE_PROPERTY::READ);
+    server_FTM_SupportedPowerRange_Chr->setValue(client_FTM_SupportedPowerRange_Str); 
+ 
+    server_FTM_TrainingStatus_Chr = server_FitnessMachine_Service->createCharacteristic(UUID16_CHR_TRAINING_STATUS, 
+                                                                            NIMBLE_PROPERTY::READ | NIMBLE_PROPERTY::NOTIFY);
+    server_FTM_TrainingStatus_Chr->setCallbacks(&server_Multi_Chr_Callbacks); //NIMBLE 
+    server_FTM_ControlPoint_Chr = server_FitnessMachine_Service->createCharacteristic(UUID16_CHR_FITNESS_MACHINE_CONTROL_POINT, 
+                                                                            NIMBLE_PROPERTY::WRITE | NIMBLE_PROPERTY::INDICATE);
+    server_FTM_ControlPoint_Chr->setCallbacks(&server_FTM_ControlPoint_Chr_Callbacks);
+    server_FitnessMachine_Service->start();      
+}
+
+class server_NUS_Rxd_Chr_callback: public BLECharacteristicCallbacks {
+  void onWrite(BLECharacteristic *pCharacteristic) {
+    // Read data received over NUS Rxd from Mobile Phone
+    char NusRxdData[SERVER_VALUE_MAXLEN+1] = {}; // Zero terminated
+    uint8_t NusRxdDataLen = GetServerValue(server_NUS_Rxd_Chr, (uint8_t*)NusRxdData);  // Get the actual length of data bytes
+    // Display the raw packet data in actual length
+    DEBUG_PRINTF(" -> Server Rec'd NUS Rxd Data [%d][%s]\n", NusRxdDataLen, NusRxdData);
+    // The following routines parse and process the incoming commands
+    // Every NusRxdData packet starts with a '!' otherwise corrupt/invalid
+    if (NusRxdData[0] != '!') {
+      DEBUG_PRINTLN(F("-> Error: RXD-packet does not start with a '!'"));
+      return; // invalid NusRxdData packet: do not further parse and process
+    }
+  // RXpacket buffer has IdCode = "S"
+  if (NusRxdData[1] == 'S') { // Settings packet
+    // Besides what is mechanically possible there are also limits in what is physically pleasant/comfortable
+    // The allowed Raw Grade Value min and max values should be within the limits of the mechanically feasible values !!!
+    // Minimally allowed Raw Grade Value that should not be exceeded: -5%!
+    // default: aRGVmin is default set to 19500
+    // Maximally allowed Raw Grade Value that should not be exceeded: 15%!
+    // default: aRGVmax is default set to: 21500
+    // New Settings values have arrived --> parse, set values and store persistently
+    uint8_t iMax = 0, iMin = 0, iPerc = 0, iDispl = 0;
+    sscanf(NusRxdData, "!S%d;%d;%d;%d;", &iMax, &iMin, &iPerc, &iDispl);
+    // set Ascent Grade Limit to aRGVmax
+    iMax = constrain(iMax, 0, RGVMAX_GRADE);
+    aRGVmax = map(iMax, 0, RGVMAX_GRADE, 20000, RGVMAX);
+    // set Descent Grade Limit to aRGVmin
+    iMin = constrain(iMin, 0, RGVMIN_GRADE); // Notice: positive value!
+    aRGVmin = map(iMin, RGVMIN_GRADE, 0, RGVMIN, 20000);
+    // set Road Grade Change Factor
+    GradeChangeFactor = iPerc;
+    // set OledDisplaySelection
+    OledDisplaySelection = iDispl;
+    // LittleFS for persistent storage of these values
+    setPRSdata();
+    // LittleFS --------------------------------------
+    DEBUG_PRINT(F(" Settings: Max: ")); DEBUG_PRINT(iMax);
+    DEBUG_PRINT(F(" Min: ")); DEBUG_PRINT(iMin);
+    DEBUG_PRINT(F(" Perc: ")); DEBUG_PRINT(iPerc);
+    DEBUG_PRINT(F(" Displ: ")); DEBUG_PRINTLN(iDispl);
+    // Confirm to the PHONE: settings rcvd and set to persistent
+    DEBUG_PRINTF("Server Sends NUS TXD Confirm message: Done!\n");
+    server_NUS_Txd_Chr->setValue("!SDone!;");
+    server_NUS_Txd_Chr->notify();
+    return; // Settings rcvd and set to persistent
+  }
+  // Manual Control Buttons Up Down get parsed and processed!
+  // ONLY when the Actuator plus sensor are working well!
+  // i.e. low level up/down movement functions work !!
+  if (NusRxdData[1] == 'U' && IsBasicMotorFunctions) {
+    DEBUG_PRINTLN("-> Set motor UPward moving!");
+    RawgradeValue = RawgradeValue + 100;
+    SetManualGradePercentValue();
+    ShowSlopeTriangleOnOled();
+    return;
+  }
+  // Bridge latency histograms are requested: "!L" to report, "!LR" to reset
+  if (NusRxdData[1] == 'L') {
+    if (NusRxdData[2] == 'R') {
+      for (uint8_t i = 0; i < LATENCY_PROBES; i++) LatencyProbes[i].Histogram->Reset();
+      server_NUS_Txd_Chr->setValue("!LDone!;");
+      server_NUS_Txd_Chr->notify();
+      return;
+    }
+    ShowBridgeLatency();
+    server_NUS_Txd_Bridge_Latency();
+    return;
+  }
+  // Connection state and transition timings are requested: "!C"
+  if (NusRxdData[1] == 'C') {
+    ShowConnectionState();
+    server_NUS_Txd_Connection_State();
+    return;
+  }
+  // Task placement, stack and latency figures are requested (Serial only): "!T"
+  if (NusRxdData[1] == 'T') {
+    ShowTaskStats();
+    server_NUS_Txd_Chr->setValue("!TDone!;");
+    server_NUS_Txd_Chr->notify();
+    return;
+  }
+  // Heap usage is requested: "!H"
+  if (NusRxdData[1] == 'H') {
+    ShowHeapUsage();
+    server_NUS_Txd_Heap_Usage();
+    return;
+  }
+  if (NusRxdData[1] == 'D' && IsBasicMotorFunctions) {
+    DEBUG_PRINTLN("-> Set motor DOWNward moving!");
+    RawgradeValue = RawgradeValue - 100;
+    SetManualGradePercentValue();
+    ShowSlopeTriangleOnOled();
+    return;
+  } 
+  server_NUS_Txd_Chr->setValue("!UOut of Order!;");
+  server_NUS_Txd_Chr->notify();
+  DEBUG_PRINTF("\nServer Sends NUS TXD Error message: Out of Order!\n");
+  }; // onWrite
+};
+static server_NUS_Rxd_Chr_callback server_NUS_Rxd_Chr_Callbacks;
+
+void server_NUS_Txd_Persistent_Settings(void) {
+    // Send persistent stored values to Mobile Phone for correct Settings!
+    // recalculate the values for use on the Phone
+    uint8_t TXpacketBuffer[16] = { 0 };
+    int iMax, iMin, iPerc, iDispl;
+    // set within limits
+    aRGVmax = constrain(aRGVmax, 0, RGVMAX);
+    aRGVmin = constrain(aRGVmin, 0, RGVMIN);
+    // set aRGVmax to Ascent Grade Limit in whole number
+    iMax = map(aRGVmax, 20000, RGVMAX, 0, RGVMAX_GRADE);
+    // set aRGVmin to Descent Grade Limit in whole number
+    iMin = map(aRGVmin, RGVMIN, 20000, RGVMIN_GRADE, 0);
+    // set GradeChangeFactor to Road Grade Change Factor
+    iPerc = GradeChangeFactor;
+    iDispl = OledDisplaySelection;
+    sprintf((char*)TXpacketBuffer, "!S%d;%d;%d;%d;", iMax, iMin, iPerc, iDispl);
+    // send these persistent data to the Settings page on the smartphone
+    server_NUS_Txd_Chr->notify(TXpacketBuffer, sizeof(TXpacketBuffer));
+    DEBUG_PRINTF("Server Sends NUS TXD Persistent settings to Phone: [%s]\n", (char*)TXpacketBuffer);
+}
+
+void ShowConnectionState(void) {
+  // Serial: current state and the time spent in each state the last time
+  DEBUG_PRINTF("Connection state: [%s] for %lu ms, transitions: %lu\n", ConnectionStateName[ConnectionState], \
+              millis() - ConnectionStateTime, ConnectionTransitions);
+  for (uint8_t i = 0; i < CONN_STATES; i++) DEBUG_PRINTF(" %s: %lu ms", ConnectionStateName[i], ConnectionStateDuration[i]);
+  DEBUG_PRINTLN();
+  DEBUG_PRINTF("Recovery attempts: %lu, next backoff: %lu ms, last time-to-recover: %lu ms\n", RecoverAttempts, RecoverBackoff, \
+              LastRecoverDuration);
+  DEBUG_PRINTF("Advertising: %s, last app discovery time: %lu ms\n", (!pAdvertising->isAdvertising() ? "Off" : \
+              (IsAdvertisingFast ? "Fast" : "Slow")), LastDiscoveryTime);
+}
+
+void ShowTaskStats(void) {
+  // Serial: placement and runtime figures of the planned tasks, CPU usage of all tasks when FreeRTOS collects run time stats
+  DEBUG_PRINTLN(F("Task                     core prio  stack   free | latency us: count    avg    max"));
+  for (uint8_t i = 0; i < TASK_PLANNED; i++) {
+    task_plan_t *P = &TaskPlan[i];
+    if (*P->Handle == NULL) {
+      DEBUG_PRINTF("%-24s not running\n", P->Name);
+      continue;
+    }
+    DEBUG_PRINTF("%-24s %4d %4u %6lu %6lu |            %5lu %6lu %6lu\n", P->Name, ((P->CoreID == tskNO_AFFINITY) ? -1 : (int)P->CoreID), \
+                (unsigned)P->Priority, (unsigned long)P->StackSize, (unsigned long)uxTaskGetStackHighWaterMark(*P->Handle), \
+                P->LatencyCount, (P->LatencyCount ? P->LatencySum/P->LatencyCount : 0), P->LatencyMax);
+    P->LatencySum = P->LatencyCount = P->LatencyMax = 0;
+  }
+  DEBUG_PRINTF("%-24s %4d %4u %6s %6lu |\n", "loop()", xPortGetCoreID(), (unsigned)uxTaskPriorityGet(NULL), "", \
+              (unsigned long)uxTaskGetStackHighWaterMark(NULL));
+#if (configUSE_TRACE_FACILITY == 1) && (configGENERATE_RUN_TIME_STATS == 1)
+  // All tasks (NimBLE host, BT controller, loopTask, idle...): CPU usage since boot, per core
+  static TaskStatus_t Status[TASK_STATS_MAX];
+  uint32_t TotalRunTime = 0;
+  UBaseType_t Count = uxTaskGetSystemState(Status, TASK_STATS_MAX, &TotalRunTime);
+  TotalRunTime /= 100; // Percentage
+  for (UBaseType_t i = 0; i < Count; i++) {
+    DEBUG_PRINTF("%-24s prio %2u stack free %6lu cpu %3lu%%\n", Status[i].pcTaskName, (unsigned)Status[i].uxCurrentPriority, \
+                (unsigned long)Status[i].usStackHighWaterMark, (unsigned long)(TotalRunTime ? Status[i].ulRunTimeCounter/TotalRunTime : 0));
+  }
+#else
+  DEBUG_PRINTLN(F("CPU usage per task: not available, FreeRTOS run time stats are not enabled in this build"));
+#endif
+}
+
+void ShowHeapUsage(void) {
+  // Serial: free heap, lowest free heap ever and the largest free block (fragmentation), drift since the baseline
+  uint32_t Free = ESP.getFreeHeap();
+  uint32_t Largest = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+  if((HeapBaseline == 0) && Trainer.IsConnected) HeapBaseline = Free;
+  DEBUG_PRINTF("Heap after %lu min: free: %lu min free: %lu largest block: %lu (fragmentation: %lu%%) drift: %ld\n", millis()/60000, \
+              (unsigned long)Free, (unsigned long)ESP.getMinFreeHeap(), (unsigned long)Largest, \
+              (unsigned long)(Free ? (100 - (Largest * 100) / Free) : 0), (HeapBaseline ? (long)Free - (long)HeapBaseline : 0L));
+}
+
+void server_NUS_Txd_Heap_Usage(void) {
+  // NUS: "!H<free>;<min free>;<largest block>;<drift since baseline>;"
+  char Line[48];
+  int MaxPayload = Smartphone.IsConnected ? (pServer->getPeerMTU(Smartphone.conn_handle)-3) : MAX_PAYLOAD;
+  if (MaxPayload < MAX_PAYLOAD) MaxPayload = MAX_PAYLOAD; // MTU not (yet) known
+  uint32_t Free = ESP.getFreeHeap();
+  int Len = snprintf(Line, sizeof(Line), "!H%lu;%lu;%lu;%ld;", (unsigned long)Free, (unsigned long)ESP.getMinFreeHeap(), \
+           (unsigned long)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT), (HeapBaseline ? (long)Free - (long)HeapBaseline : 0L));
+  Len = min(Len, (int)sizeof(Line)-1);
+  for (int Sent = 0; Sent < Len; Sent += MaxPayload) {
+    server_NUS_Txd_Chr->notify((uint8_t*)&Line[Sent], min(Len-Sent, MaxPayload));
+  }
+  DEBUG_PRINTLN("Server Sends NUS TXD Heap usage to Phone");
+}
+
+void server_NUS_Txd_Connection_State(void) {
+  // NUS: "!C<state>;<ms in state>;<ms per state: Scan;Connect;Discover;Subscribe;Ready;Recover>;<recovery attempts>;<last ms to recover>;"
+  char Line[120];
+  int MaxPayload = Smartphone.IsConnected ? (pServer->getPeerMTU(Smartphone.conn_handle)-3) : MAX_PAYLOAD;
+  if (MaxPayload < MAX_PAYLOAD) MaxPayload = MAX_PAYLOAD; // MTU not (yet) known
+  int Len = snprintf(Line, sizeof(Line), "!C%s;%lu;", ConnectionStateName[ConnectionState], millis() - ConnectionStateTime);
+  for (uint8_t i = 0; (i < CONN_STATES) && (Len < (int)sizeof(Line)); i++) {
+    Len += snprintf(&Line[Len], sizeof(Line)-Len, "%lu;", ConnectionStateDuration[i]);
+  }
+  if (Len < (int)sizeof(Line)) Len += snprintf(&Line[Len], sizeof(Line)-Len, "%lu;%lu;", RecoverAttempts, LastRecoverDuration);
+  Len = min(Len, (int)sizeof(Line)-1);
+  for (int Sent = 0; Sent < Len; Sent += MaxPayload) {
+    server_NUS_Txd_Chr->notify((uint8_t*)&Line[Sent], min(Len-Sent, MaxPayload));
+  }
+  DEBUG_PRINTLN("Server Sends NUS TXD Connection state to Phone");
+}
+
+void ShowBridgeLatency(void) {
+  // Serial: summary and bucket counts of all bridge latency histograms
+  DEBUG_PRINT(F("Bridge latency (us)                  count    avg    p50    p95    max | buckets <="));
+  for (uint8_t b = 0; b < (LATENCY_BUCKETS-1); b++) DEBUG_PRINTF(" %lu", (unsigned long)LatencyHistogram::GetBucketBound(b));
+  DEBUG_PRINTLN(" >");
+  for (uint8_t i = 0; i < LATENCY_PROBES; i++) {
+    LatencyHistogram *H = LatencyProbes[i].Histogram;
+    DEBUG_PRINTF("%-32s %9lu %6lu %6lu %6lu %6lu |", LatencyProbes[i].Name, (unsigned long)H->GetCount(), (unsigned long)H->GetAverage(), \
+                (unsigned long)H->GetPercentile(50), (unsigned long)H->GetPercentile(95), (unsigned long)H->GetMax());
+    for (uint8_t b = 0; b < LATENCY_BUCKETS; b++) DEBUG_PRINTF(" %lu", (unsigned long)H->GetBucketCount(b));
+    DEBUG_PRINTLN();
+  }
+}
+
+void server_NUS_Txd_Bridge_Latency(void) {
+  // NUS: one line per histogram "!L<Tag>;<count>;<avg>;<p95>;<max>;<bucket counts,...>;" (us)
+  // sent in chunks that fit the MTU of the phone link, the phone reassembles a line from its '!' up to the next one
+  char Line[200]; // Fits 4 summary values and all bucket counts of 10 digits
+  int MaxPayload = Smartphone.IsConnected ? (pServer->getPeerMTU(Smartphone.conn_handle)-3) : MAX_PAYLOAD;
+  if (MaxPayload < MAX_PAYLOAD) MaxPayload = MAX_PAYLOAD; // MTU not (yet) known
+  for (uint8_t i = 0; i < LATENCY_PROBES; i++) {
+    LatencyHistogram *H = LatencyProbes[i].Histogram;
+    int Len = snprintf(Line, sizeof(Line), "!L%s;%lu;%lu;%lu;%lu;", LatencyProbes[i].Tag, (unsigned long)H->GetCount(), \
+                      (unsigned long)H->GetAverage(), (unsigned long)H->GetPercentile(95), (unsigned long)H->GetMax());
+    for (uint8_t b = 0; (b < LATENCY_BUCKETS) && (Len < (int)sizeof(Line)); b++) {
+      Len += snprintf(&Line[Len], sizeof(Line)-Len, (b < (LATENCY_BUCKETS-1)) ? "%lu," : "%lu;", (unsigned long)H->GetBucketCount(b));
+    }
+    Len = min(Len, (int)sizeof(Line)-1);
+    for (int Sent = 0; Sent < Len; Sent += MaxPayload) {
+      server_NUS_Txd_Chr->notify((uint8_t*)&Line[Sent], min(Len-Sent, MaxPayload));
+    }
+  }
+  server_NUS_Txd_Chr->setValue("!LDone!;");
+  server_NUS_Txd_Chr->notify();
+  DEBUG_PRINTLN("Server Sends NUS TXD Bridge latency histograms to Phone");
+}
+
+// Handler class for Server NUS Txd Characteristic actions limited to onSubscribe
+class server_NUS_Txd_Callback: public NimBLECharacteristicCallbacks {
+/*  We only define onSubscribe !!!
+    void onRead(NimBLECharacteristic* pCharacteristic);
+    void onWrite(NimBLECharacteristic* pCharacteristic);
+    void onNotify(NimBLECharacteristic* pCharacteristic);    
+    void onStatus(NimBLECharacteristic* pCharacteristic, Status status, int code);
+*/  
+  void onSubscribe(NimBLECharacteristic* pCharacteristic, ble_gap_conn_desc* desc, uint16_t subValue) {
+          String str = "Central Updated CCCD -->";
+        if(subValue == 0) {
+            str += " Notify/Indicate Disabled for Char:";
+        }else if(subValue == 1) {
+            str += " Notify Enabled for Char:";
+        } else if(subValue == 2) {
+            str += " Indicate Enabled for Char:";
+        } else if(subValue == 3) {
+            str += " Notify & Indicate Enabled for Char:";
+        }
+        DEBUG_PRINTF("%s", str.c_str());
+        str = std::string(pCharacteristic->getUUID()).c_str();
+        DEBUG_PRINTF(" [%s]\n", str.c_str());
+
+        if(subValue == 1) {
+          server_NUS_Txd_Persistent_Settings();
+        }
+    };
+};
+static server_NUS_Txd_Callback server_NUS_Txd_Chr_Callbacks;
+
+void server_setupNUS(void)
+{
+    server_NordicUart_Service = pServer->createService(UUID_NUS_SERVICE);
+    server_NUS_Rxd_Chr = server_NordicUart_Service->createCharacteristic(UUID_NUS_CHR_RXD, 
+                                                                            NIMBLE_PROPERTY::WRITE_NR); // Write with No response !!
+    server_NUS_Rxd_Chr->setCallbacks(&server_NUS_Rxd_Chr_Callbacks); 
+    server_NUS_Txd_Chr = server_NordicUart_Service->createCharacteristic(UUID_NUS_CHR_TXD, 
+                                                                            NIMBLE_PROPERTY::READ | NIMBLE_PROPERTY::NOTIFY);
+    server_NUS_Txd_Chr->setCallbacks(&server_NUS_Txd_Chr_Callbacks); //NIMBLE
+    server_NordicUart_Service->start();
+}
+
+void server_setupGA(void)
+{
+  // Set the Generic Access Appearance value from default: [0] --> Unknown to [1152] --> Generic Cycling
+    int RespErr = ble_svc_gap_device_appearance_set(client_GA_Appearance_Value);
+    if(RespErr == 0) {
+      DEBUG_PRINTF("Successfully Set Generic Access Appearance Chr value to:  [%d] Generic Cycling\n", client_GA_Appearance_Value); 
+    } else {
+      DEBUG_PRINTLN("Unable to Set Generic Access Appearance Chr value!");      
+    } 
+  // Set Generic Access Device Name Chr to a value
+    RespErr = ble_svc_gap_device_name_set((const char*)client_GA_DeviceName_Str.c_str());
+    if(RespErr == 0) {
+      DEBUG_PRINTF("Successfully Set Generic Access Device Name Chr value to: [%s]\n", client_GA_DeviceName_Str.c_str()); 
+    } else {
+      DEBUG_PRINTLN("Unable to Set Generic Access Device Name Chr value!");      
+    } 
+}
+
+void server_setupDIS(void)
+{
+    server_DeviceInformation_Service = pServer->createService(UUID16_SVC_DEVICE_INFORMATION);
+    server_DIS_ModelNumber_Chr = server_DeviceInformation_Service->createCharacteristic(UUID16_CHR_MODEL_NUMBER_STRING, 
+                                                                            NIMBLE_PROPERTY::READ);
+    server_DIS_ModelNumber_Chr->setValue(client_DIS_ModelNumber_Str);
+    server_DIS_SerialNumber_Chr = server_DeviceInformation_Service->createCharacteristic(UUID16_CHR_SERIAL_NUMBER_STRING, 
+                                                                            NIMBLE_PROPERTY::READ);
+    server_DIS_SerialNumber_Chr->setValue(client_DIS_SerialNumber_Str);
+    server_DIS_ManufacturerName_Chr = server_DeviceInformation_Service->createCharacteristic(UUID16_CHR_MANUFACTURER_NAME_STRING, 
+                                                                            NIMBLE_PROPERTY::READ);                                                                                        
+    server_DIS_ManufacturerName_Chr->setValue(client_DIS_Manufacturer_Str);
+/*
+    server_DIS_Firmware_Chr = server_DeviceInformation_Service->createCharacteristic(UUID16_CHR_FIRMWARE_REVISION_STRING, 
+                                                                            NIMBLE_PROPERTY::READ);
+    server_DIS_Hardware_Chr = server_DeviceInformation_Service->createCharacteristic(UUID16_CHR_HARDWARE_REVISION_STRING, 
+                                                                            NIMBLE_PROPERTY::READ);
+    server_DIS_Software_Chr = server_DeviceInformation_Service->createCharacteristic(UUID16_CHR_SOFTWARE_REVISION_STRING, 
+                                                                            NIMBLE_PROPERTY::READ);
+    server_DIS_Hardware_Chr->setValue(client_DIS_Hardware_Str);
+    server_DIS_Firmware_Chr->setValue(client_DIS_Firmware_Str);
+    server_DIS_Software_Chr->setValue(client_DIS_Software_Str);
+*/
+    server_DeviceInformation_Service->start();
+}
+
+/*
+    Field #1 - Flags (byte)
+        Bit 0   - Heart Rate Value Format
+                    0 = uint8
+                    1 = uint16
+        Bit 1-2 - Sensor Contact Status
+                    0 - Sensor Contact feature is not supported in the current connection
+                    1 - Sensor Contact feature is not supported in the current connection
+                    2 - Sensor Contact feature is supported, but contact is not detected
+                    3 - Sensor Contact feature is supported and contact is detected
+        Bit 3   - Energy Expended Status
+                    0 = Energy Expended field is not present
+                    1 = Energy Expended field is present. Units: kilo Joules
+        Bit 3   - RR-Interval bit
+                    0 = RR-Interval values are not present.
+                    1 = One or more RR-Interval values are present.
+        Bit 5-7 - Reserved
+    Field #2 - Heart Rate Measurement Value (uint8)
+    Field #3 - Heart Rate Measurement Value (uint16)
+    Field #4 - Energy Expended (uint16)
+    Field #5 - RR-Interval (uint16)
+    // Flags = Format uint16 and contact supported and detected
+    //byte HR_MeasurementFlags = 0b00000101;
+*/
+
+void server_setupHRM(void)
+{
+    server_HeartRate_Service = pServer->createService(UUID16_SVC_HEART_RATE);
+    server_HR_Measurement_Chr = server_HeartRate_Service->createCharacteristic(UUID16_CHR_HEART_RATE_MEASUREMENT, 
+                                                                            NIMBLE_PROPERTY::NOTIFY); // Notify only (spec), never read
+    server_HR_Measurement_Chr->setCallbacks(&server_Multi_Chr_Callbacks); //NIMBLE
+    server_HR_Location_Chr = server_HeartRate_Service->createCharacteristic(UUID16_CHR_BODY_SENSOR_LOCATION, 
+                                                                            NIMBLE_PROPERTY::READ);
+    // Set server_HR_Location for sensor
+    server_HR_Location_Chr->setValue(&client_HR_Location_Value, 1);
+    server_HeartRate_Service->start();  
+}
+
+void client_Write_Next_CCCD(void) {
+  // First write by the requester, the next ones in the NimBLE host task as soon as a response arrives
+  for(; CCCDIndex < CLIENT_CHR_COUNT; CCCDIndex++) {
+    client_chr_t *C = &ClientCharacteristics[CCCDIndex];
+    if((C->Callback == NULL) || (C->CCCDHandle == 0)) continue; // Not exposed by this trainer
+    if(CCCDOptionalOnly && client_Is_Critical(C)) continue;
+    const uint8_t *Value = CCCDEnable ? (C->IsIndicate ? indicationOn : notificationOn) : notificationOff;
+    if(ble_gattc_write_flat(Trainer.conn_handle, C->CCCDHandle, Value, 2, client_CCCD_Callback, (void*)(uintptr_t)CCCDSeq) == 0) {
+      CCCDWrites++;
+      return; // Continued in client_CCCD_Callback()
+    }
+    CCCDFailures++; // Not even sent: no connection or no resources
+    CCCDRetries = 0;
+  }
+  xSemaphoreGive(xCCCDDone);
+}
+
+int client_CCCD_Callback(uint16_t conn_handle, const struct ble_gatt_error *error, struct ble_gatt_attr *attr, void *arg) {
+  if((uint32_t)(uintptr_t)arg != CCCDSeq) return 0; // Run timed out already
+  if((error->status != 0) && (CCCDRetries < CCCD_WRITE_RETRIES)) {
+    CCCDRetries++; // Retry this CCCD only
+  } else {
+    if(error->status != 0) CCCDFailures++;
+    CCCDRetries = 0;
+    CCCDIndex++;
+  }
+  client_Write_Next_CCCD();
+  return 0;
+}
+
+bool client_Set_All_NotificationIndication(bool IsEnable)
+{
+  return client_Set_NotificationIndication(IsEnable, false);
+}
+
+bool client_Set_NotificationIndication(bool IsEnable, bool IsOptionalOnly)
+{
+  // Driven by the CCCD handles of the discovery or the GATT cache, no getDescriptor() lookups
+  xSemaphoreTake(xGattRequestMutex, portMAX_DELAY); // No Control Point write in between
+  xSemaphoreTake(xCCCDDone, 0); // Clear a late completion
+  unsigned long StartTime = millis();
+  CCCDSeq++;
+  CCCDEnable = IsEnable;
+  CCCDOptionalOnly = IsOptionalOnly;
+  CCCDIndex = 0;
+  CCCDRetries = 0;
+  CCCDWrites = 0;
+  CCCDFailures = 0;
+  client_Write_Next_CCCD();
+  bool IsDone = (xSemaphoreTake(xCCCDDone, pdMS_TO_TICKS(CCCD_ALL_TIMEOUT)) == pdTRUE);
+  if(!IsDone) CCCDSeq++; // Ignore the responses that are still underway
+  xSemaphoreGive(xGattRequestMutex);
+  DEBUG_PRINTF("%s Client (Trainer) Characteristics are Notify/Indicate %s: %d writes in %lu ms, failures: %d%s\n", \
+              (IsOptionalOnly ? "Optional" : "All"), (IsEnable ? "Enabled" : "Disabled"), CCCDWrites, millis() - StartTime, CCCDFailures, (IsDone ? "" : ", TIMED OUT"));
+  return IsDone && (CCCDFailures == 0);
+} // end
+
+void loop() { // loop() is the connection state machine: it handles the events of the BLE callbacks
+  // Block until an event arrives: handled immediately, and the idle task runs in between (no Task watchdog trigger)
+  // While optional services are pending it only polls the events
+  bool IsOptionalPending = (OptionalStep < OPTIONAL_SERVICE_COUNT) && Trainer.IsConnected;
+  EventBits_t Events = xEventGroupWaitBits(xConnectionEvents, EVT_ALL, pdTRUE, pdFALSE, (IsOptionalPending ? 0 : pdMS_TO_TICKS(LOOP_PERIOD)));
+  // Enable or disable Notify and Indicate on ALL Client Char's of BLE server!
+  // Both events can be pending at once: the current subscriptions decide, not the order of the event bits
+  if((Events & (EVT_CLIENT_ENABLE | EVT_CLIENT_DISABLE)) && Trainer.IsConnected) {
+    if(!client_Set_All_NotificationIndication(IS_TRAINER_DATA_WANTED) && IsGattCacheUnverified) {
+      DEBUG_PRINTLN("GATT cache: CCCD write failed --> removed, next connect does a full discovery!");
+      TrainerGattCache.Remove(Trainer.PeerAddress);
+      pClient_FTMS->disconnect(); // Recovered with EVT_TRAINER_LOST
+    }
+    IsGattCacheUnverified = false;
+  }
+  // The scan has found the trainer: connect, discover and subscribe
+  if((Events & EVT_TRAINER_FOUND) && (ConnectionState == CONN_SCAN)) {
+    if(!client_Connect_Callback()) client_Backoff();
+  }
+  // Scan stage is over (rank window has passed or the scan window has ended) with candidates: connect to the best one,
+  // a remembered trainer is searched for during full scan windows first, it can advertise later than its neighbours
+  if((ConnectionState == CONN_SCAN) && !IsTrainerFound && (ScanCandidateCount > 0) && \
+     (IsTrainerRemembered ? ((Events & EVT_SCAN_ENDED) && (RecoverAttempts >= SCAN_REMEMBERED_ATTEMPTS)) : \
+     ((Events & EVT_SCAN_ENDED) || ((millis() - ScanRankStartTime) >= SCAN_RANK_WINDOW)))) {
+    client_Select_Candidate();
+    if(!client_Connect_Callback()) {
+      client_Restore_Trainer();
+      client_Backoff();
+    }
+  }
+  // The scan window has ended without the trainer: wait before the next attempt (bounded scan duty cycle)
+  if((Events & EVT_SCAN_ENDED) && (ConnectionState == CONN_SCAN)) {
+    client_Backoff();
+  }
+  // Backoff has elapsed: next attempt
+  if((RecoverNextTime != 0) && ((long)(millis() - RecoverNextTime) >= 0)) {
+    client_Recover();
+  }
+  // The trainer is lost: reconnect directly or scan again (a failing connect attempt recovers by itself,
+  // its disconnect event is stale when the next attempt has succeeded)
+  if((Events & EVT_TRAINER_LOST) && (ConnectionState == CONN_READY) && !pClient_FTMS->isConnected()) {
+    client_Recover();
+  }
+  // Background phase of the discovery: one optional service per pass, so events are handled in between
+  if((OptionalStep < OPTIONAL_SERVICE_COUNT) && (ConnectionState == CONN_READY) && Trainer.IsConnected) {
+    client_Discover_Optional();
+  }
+  // Periodic heap and task report: no heap growth or fragmentation, no stack or scheduling trouble over a long ride
+  if((millis() - HeapReportTime) >= HEAP_REPORT_PERIOD) {
+    HeapReportTime = millis();
+    ShowHeapUsage();
+    ShowTaskStats();
+  }
+  // Fast advertising phase is over: slow down
+  if(IsAdvertisingFast && pAdvertising->isAdvertising() && ((millis() - AdvertisingStartTime) >= ADV_FAST_PERIOD)) {
+    server_Start_Advertising(false);
+  }
+  // (Re)negotiate connection parameters when the link policy changes its target
+  ApplyLinkPolicy(&TrainerLink);
+  ApplyLinkPolicy(&AppLink);
+  RefreshCentrals();
+} // End of loop
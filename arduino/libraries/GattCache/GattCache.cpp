@@ -0,0 +1,114 @@
+/*
+ * GattCache class: discovered GATT handles of one peer, persisted in LittleFS
+ * Version #1
+ *
+ */
+#include "GattCache.h"
+#include <LittleFS.h>
+
+GattCache::GattCache() {
+  uint8_t NoAddress[6] = {};
+  Clear(NoAddress);
+}
+
+void GattCache::FileName(char *Name, const uint8_t *Address)
+{
+  // One file per peer: /gatt_<address>.bin
+  sprintf(Name, "/gatt_%02X%02X%02X%02X%02X%02X.bin", Address[5], Address[4], Address[3], Address[2], Address[1], Address[0]);
+}
+
+void GattCache::Clear(const uint8_t *Address)
+{
+  _Version = GATT_CACHE_VERSION;
+  memcpy(_Address, Address, 6);
+  _HasHash = false;
+  memset(_Hash, 0, GATT_CACHE_HASH_LEN);
+  _Count = 0;
+  memset(_Entries, 0, sizeof(_Entries));
+}
+
+bool GattCache::Load(const uint8_t *Address)
+{
+  char Name[24];
+  FileName(Name, Address);
+  Clear(Address);
+  if (!LittleFS.exists(Name)) return false;
+  File file = LittleFS.open(Name, FILE_READ);
+  if (!file) return false;
+  bool IsLoaded = (file.read((uint8_t*)&_Version, sizeof(_Version)) == sizeof(_Version)) && (_Version == GATT_CACHE_VERSION) &&
+                  (file.read(_Address, 6) == 6) && (memcmp(_Address, Address, 6) == 0) &&
+                  (file.read((uint8_t*)&_HasHash, sizeof(_HasHash)) == sizeof(_HasHash)) &&
+                  (file.read(_Hash, GATT_CACHE_HASH_LEN) == GATT_CACHE_HASH_LEN) &&
+                  (file.read(&_Count, 1) == 1) && (_Count <= GATT_CACHE_ENTRIES) &&
+                  (file.read((uint8_t*)_Entries, _Count*sizeof(gatt_cache_entry_t)) == (_Count*sizeof(gatt_cache_entry_t)));
+  file.close();
+  if (!IsLoaded) Clear(Address); // Old layout or corrupt: start from scratch
+  return IsLoaded;
+}
+
+bool GattCache::Save(void)
+{
+  char Name[24];
+  FileName(Name, _Address);
+  File file = LittleFS.open(Name, FILE_WRITE);
+  if (!file) return false;
+  size_t Written = file.write((uint8_t*)&_Version, sizeof(_Version));
+  Written += file.write(_Address, 6);
+  Written += file.write((uint8_t*)&_HasHash, sizeof(_HasHash));
+  Written += file.write(_Hash, GATT_CACHE_HASH_LEN);
+  Written += file.write(&_Count, 1);
+  Written += file.write((uint8_t*)_Entries, _Count*sizeof(gatt_cache_entry_t));
+  file.close();
+  return (Written == (sizeof(_Version) + 6 + sizeof(_HasHash) + GATT_CACHE_HASH_LEN + 1 + (_Count*sizeof(gatt_cache_entry_t))));
+}
+
+void GattCache::Remove(const uint8_t *Address)
+{
+  char Name[24];
+  FileName(Name, Address);
+  if (LittleFS.exists(Name)) LittleFS.remove(Name);
+  Clear(Address);
+}
+
+bool GattCache::Add(uint16_t Service, uint16_t Characteristic, uint16_t ValueHandle, uint16_t CCCDHandle, const uint8_t *Value, size_t Length)
+{
+  if (_Count >= GATT_CACHE_ENTRIES) return false;
+  gatt_cache_entry_t *E = &_Entries[_Count++];
+  E->Service = Service;
+  E->Characteristic = Characteristic;
+  E->ValueHandle = ValueHandle;
+  E->CCCDHandle = CCCDHandle;
+  E->ValueLength = (uint16_t)Length;
+  if ( (Length > 0) && (Length <= GATT_CACHE_VALUE_LEN) ) memcpy(E->Value, Value, Length); // Else only its length
+  return true;
+}
+
+const gatt_cache_entry_t *GattCache::Find(uint16_t Service, uint16_t Characteristic)
+{
+  for (uint8_t i = 0; i < _Count; i++) {
+    if ( (_Entries[i].Service == Service) && (_Entries[i].Characteristic == Characteristic) ) return &_Entries[i];
+  }
+  return NULL;
+}
+
+void GattCache::SetHash(const uint8_t *Hash)
+{
+  _HasHash = (Hash != NULL);
+  if (_HasHash) memcpy(_Hash, Hash, GATT_CACHE_HASH_LEN);
+  else memset(_Hash, 0, GATT_CACHE_HASH_LEN);
+}
+
+bool GattCache::HasHash(void)
+{
+  return _HasHash;
+}
+
+bool GattCache::IsHashEqual(const uint8_t *Hash)
+{
+  return _HasHash && (memcmp(_Hash, Hash, GATT_CACHE_HASH_LEN) == 0);
+}
+
+uint8_t GattCache::GetCount(void)
+{
+  return _Count;
+}
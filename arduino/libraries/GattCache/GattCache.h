@@ -0,0 +1,54 @@
+/*
+ * GattCache class: discovered GATT handles of one peer, persisted in LittleFS
+ * After a full discovery the value and CCCD handles of the characteristics that are
+ * used, and their static values (features, ranges, names), are saved in a file per
+ * peer address. At reconnect the cache is loaded and validated against the Database
+ * Hash of the peer: when it matches, discovery and reading can be skipped.
+ * Values longer than GATT_CACHE_VALUE_LEN are not stored: the entry keeps their real
+ * length only, so the caller knows it has to read them again.
+ */
+#ifndef GattCache_h
+#define GattCache_h
+
+#include "Arduino.h"
+
+#define GATT_CACHE_ENTRIES   24  // Max number of cached characteristics
+#define GATT_CACHE_VALUE_LEN 32  // Max size of a cached static value in bytes
+#define GATT_CACHE_HASH_LEN  16  // Size of the Database Hash
+#define GATT_CACHE_VERSION    2  // Change when the file layout changes!
+
+typedef struct {
+  uint16_t Service;        // 16 bit UUID's
+  uint16_t Characteristic;
+  uint16_t ValueHandle;
+  uint16_t CCCDHandle;     // 0 -> no CCCD
+  uint16_t ValueLength;    // 0 -> no static value, > GATT_CACHE_VALUE_LEN -> value not cached
+  uint8_t Value[GATT_CACHE_VALUE_LEN];
+} gatt_cache_entry_t;
+
+class GattCache {
+
+  uint32_t _Version;
+  uint8_t _Address[6];
+  bool _HasHash;
+  uint8_t _Hash[GATT_CACHE_HASH_LEN];
+  uint8_t _Count;
+  gatt_cache_entry_t _Entries[GATT_CACHE_ENTRIES];
+  void FileName(char *Name, const uint8_t *Address);
+
+public:
+
+  GattCache();
+  void Clear(const uint8_t *Address);
+  bool Load(const uint8_t *Address);
+  bool Save(void);
+  void Remove(const uint8_t *Address);
+  bool Add(uint16_t Service, uint16_t Characteristic, uint16_t ValueHandle, uint16_t CCCDHandle, const uint8_t *Value, size_t Length);
+  const gatt_cache_entry_t *Find(uint16_t Service, uint16_t Characteristic);
+  void SetHash(const uint8_t *Hash);
+  bool HasHash(void);
+  bool IsHashEqual(const uint8_t *Hash);
+  uint8_t GetCount(void);
+};
+
+#endif
@@ -0,0 +1,70 @@
+/*
+ * LatencyHistogram class: fixed bucket histogram of latencies in microseconds
+ * Version #1
+ *
+ */
+#include "LatencyHistogram.h"
+
+// Upper bound (us) of each bucket, the last bucket is open ended
+static const uint32_t _Bounds[LATENCY_BUCKETS] = { 250, 500, 1000, 2000, 5000, 10000, 20000, 50000,
+                                                   100000, 200000, 500000, 0xFFFFFFFF };
+
+LatencyHistogram::LatencyHistogram() {
+  Reset();
+}
+
+void LatencyHistogram::Record(uint32_t Micros)
+{
+  uint8_t Bucket = 0;
+  while ( Micros > _Bounds[Bucket] ) Bucket++;
+  _Buckets[Bucket]++;
+  _Count++;
+  _Sum += Micros;
+  if ( Micros > _Max ) _Max = Micros;
+}
+
+uint32_t LatencyHistogram::GetCount(void)
+{
+  return _Count;
+}
+
+uint32_t LatencyHistogram::GetAverage(void)
+{
+  return (_Count > 0) ? (uint32_t)(_Sum / _Count) : 0;
+}
+
+uint32_t LatencyHistogram::GetMax(void)
+{
+  return _Max;
+}
+
+uint32_t LatencyHistogram::GetPercentile(uint8_t Percent)
+{
+  // Upper bound of the bucket that holds the requested percentile, the maximum for the last bucket
+  if ( _Count == 0 ) return 0;
+  uint32_t Target = ((_Count * Percent) + 99) / 100;
+  uint32_t Cumulative = 0;
+  for (uint8_t Bucket = 0; Bucket < (LATENCY_BUCKETS - 1); Bucket++) {
+    Cumulative += _Buckets[Bucket];
+    if ( Cumulative >= Target ) return min(_Bounds[Bucket], (uint32_t)_Max);
+  }
+  return _Max;
+}
+
+uint32_t LatencyHistogram::GetBucketCount(uint8_t Bucket)
+{
+  return (Bucket < LATENCY_BUCKETS) ? _Buckets[Bucket] : 0;
+}
+
+uint32_t LatencyHistogram::GetBucketBound(uint8_t Bucket)
+{
+  return (Bucket < LATENCY_BUCKETS) ? _Bounds[Bucket] : 0;
+}
+
+void LatencyHistogram::Reset(void)
+{
+  for (uint8_t Bucket = 0; Bucket < LATENCY_BUCKETS; Bucket++) _Buckets[Bucket] = 0;
+  _Count = 0;
+  _Sum = 0;
+  _Max = 0;
+}
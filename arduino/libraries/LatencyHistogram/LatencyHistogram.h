@@ -0,0 +1,34 @@
+/*
+ * LatencyHistogram class: fixed bucket histogram of latencies in microseconds
+ * Buckets are roughly logarithmic from 250 us up to 500 ms, the last bucket holds
+ * everything above. Recording is constant time and allocation free, the summary
+ * (count, average, maximum and percentiles) is derived from the bucket counts.
+ */
+#ifndef LatencyHistogram_h
+#define LatencyHistogram_h
+
+#include "Arduino.h"
+
+#define LATENCY_BUCKETS 12
+
+class LatencyHistogram {
+
+  volatile uint32_t _Buckets[LATENCY_BUCKETS];
+  volatile uint32_t _Count;
+  volatile uint64_t _Sum;   // us, 64 bit: 32 bit would wrap after 71 minutes of accumulated latency
+  volatile uint32_t _Max;
+
+public:
+
+  LatencyHistogram();
+  void Record(uint32_t Micros);
+  uint32_t GetCount(void);
+  uint32_t GetAverage(void);
+  uint32_t GetMax(void);
+  uint32_t GetPercentile(uint8_t Percent);
+  uint32_t GetBucketCount(uint8_t Bucket);
+  static uint32_t GetBucketBound(uint8_t Bucket);
+  void Reset(void);
+};
+
+#endif
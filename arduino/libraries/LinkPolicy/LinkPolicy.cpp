@@ -0,0 +1,132 @@
+/*
+ * LinkPolicy class: connection parameter policy for one BLE link
+ * Version #1
+ *
+ */
+#include "LinkPolicy.h"
+
+LinkPolicy::LinkPolicy() {
+  _Name = "";
+  _Active = { 12, 24, 0, 400 };
+  _Idle = { 24, 48, 0, 400 };
+  _IdleAfterMs = 5000;
+  _ConnHandle = 0xFFFF;
+  _LastActivity = 0;
+  _IsConnected = false;
+  _IsActive = false;
+  _IsRequested = false;
+  _Interval = 0;
+  _Latency = 0;
+  _Timeout = 0;
+  _Renegotiations = 0;
+}
+
+void LinkPolicy::Init(const char *Name, conn_params_t Active, conn_params_t Idle, uint32_t IdleAfterMs)
+{
+  _Name = Name;
+  _Active = Active;
+  _Idle = Idle;
+  _IdleAfterMs = IdleAfterMs;
+}
+
+void LinkPolicy::Connected(uint16_t ConnHandle, uint16_t Interval, uint16_t Latency, uint16_t Timeout)
+{
+  _ConnHandle = ConnHandle;
+  _IsConnected = true;
+  // Start active: service discovery and the first commands follow right after connecting
+  _IsActive = true;
+  _IsRequested = false;
+  _LastActivity = millis();
+  _Interval = Interval;
+  _Latency = Latency;
+  _Timeout = Timeout;
+}
+
+void LinkPolicy::Disconnected(void)
+{
+  _IsConnected = false;
+  _ConnHandle = 0xFFFF;
+  _IsRequested = false;
+}
+
+void LinkPolicy::Activity(void)
+{
+  _LastActivity = millis();
+  if ( !_IsActive ) {
+    _IsActive = true;
+    _IsRequested = false;
+  }
+}
+
+const conn_params_t *LinkPolicy::Evaluate(uint32_t now)
+{
+  // Returns the parameters to request when the target profile has changed, NULL otherwise
+  if ( !_IsConnected ) return NULL;
+  if ( _IsActive && ((now - _LastActivity) >= _IdleAfterMs) ) {
+    _IsActive = false;
+    _IsRequested = false;
+  }
+  if ( _IsRequested ) return NULL;
+  _IsRequested = true;
+  _Renegotiations++;
+  return _IsActive ? &_Active : &_Idle;
+}
+
+bool LinkPolicy::IsAcceptable(uint16_t MinInterval, uint16_t MaxInterval, uint16_t Latency, uint16_t Timeout)
+{
+  // A peer request is acceptable when it is at least as fast as the target profile allows:
+  // the controller can pick any interval of the requested range, so the whole range has to fit
+  const conn_params_t *Target = _IsActive ? &_Active : &_Idle;
+  return (MinInterval <= MaxInterval) && (MaxInterval <= Target->MaxInterval) && \
+         (Latency <= Target->Latency) && (Timeout <= Target->Timeout);
+}
+
+bool LinkPolicy::SetAchieved(uint16_t Interval, uint16_t Latency, uint16_t Timeout)
+{
+  // Returns true when the achieved parameters have changed
+  if ( (Interval == _Interval) && (Latency == _Latency) && (Timeout == _Timeout) ) return false;
+  _Interval = Interval;
+  _Latency = Latency;
+  _Timeout = Timeout;
+  return true;
+}
+
+const char *LinkPolicy::GetName(void)
+{
+  return _Name;
+}
+
+uint16_t LinkPolicy::GetConnHandle(void)
+{
+  return _ConnHandle;
+}
+
+bool LinkPolicy::IsConnected(void)
+{
+  return _IsConnected;
+}
+
+bool LinkPolicy::IsActive(void)
+{
+  return _IsActive;
+}
+
+uint16_t LinkPolicy::GetInterval(void)
+{
+  return _Interval;
+}
+
+uint16_t LinkPolicy::GetLatency(void)
+{
+  return _Latency;
+}
+
+uint16_t LinkPolicy::GetTimeout(void)
+{
+  return _Timeout;
+}
+
+uint32_t LinkPolicy::GetRenegotiations(void)
+{
+  return _Renegotiations;
+}
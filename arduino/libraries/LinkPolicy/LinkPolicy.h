@@ -0,0 +1,59 @@
+/*
+ * LinkPolicy class: connection parameter policy for one BLE link
+ * A link has a fast (Active) and a relaxed (Idle) set of connection parameters.
+ * Traffic that needs a short response time (i.c. Control Point commands) marks the
+ * link active, after IdleAfterMs without such traffic the link falls back to idle.
+ * Evaluate() returns the parameters to (re)negotiate only when the target changes,
+ * the parameters that were actually achieved are tracked with SetAchieved().
+ * Units: intervals in 1.25 ms, latency in connection events, timeout in 10 ms.
+ */
+#ifndef LinkPolicy_h
+#define LinkPolicy_h
+
+#include "Arduino.h"
+
+typedef struct {
+  uint16_t MinInterval;
+  uint16_t MaxInterval;
+  uint16_t Latency;
+  uint16_t Timeout;
+} conn_params_t;
+
+class LinkPolicy {
+
+  const char *_Name;
+  conn_params_t _Active;
+  conn_params_t _Idle;
+  uint32_t _IdleAfterMs;
+  uint16_t _ConnHandle;
+  volatile uint32_t _LastActivity;
+  bool _IsConnected;
+  bool _IsActive;     // Target profile
+  bool _IsRequested;  // Target profile has been requested
+  // Achieved connection parameters
+  uint16_t _Interval;
+  uint16_t _Latency;
+  uint16_t _Timeout;
+  uint32_t _Renegotiations;
+
+public:
+
+  LinkPolicy();
+  void Init(const char *Name, conn_params_t Active, conn_params_t Idle, uint32_t IdleAfterMs);
+  void Connected(uint16_t ConnHandle, uint16_t Interval, uint16_t Latency, uint16_t Timeout);
+  void Disconnected(void);
+  void Activity(void);
+  const conn_params_t *Evaluate(uint32_t now);
+  bool IsAcceptable(uint16_t MinInterval, uint16_t MaxInterval, uint16_t Latency, uint16_t Timeout);
+  bool SetAchieved(uint16_t Interval, uint16_t Latency, uint16_t Timeout);
+  const char *GetName(void);
+  uint16_t GetConnHandle(void);
+  bool IsConnected(void);
+  bool IsActive(void);
+  uint16_t GetInterval(void);
+  uint16_t GetLatency(void);
+  uint16_t GetTimeout(void);
+  uint32_t GetRenegotiations(void);
+};
+
+#endif
@@ -0,0 +1,82 @@
+/*
+ * PacketRing class: lock-free SPSC ring of fixed size packets
+ * Version #1
+ *
+ */
+#include "PacketRing.h"
+
+PacketRing::PacketRing() {
+  _Head = 0;
+  _Tail = 0;
+  _Pushed = 0;
+  _Overflows = 0;
+  _Oversize = 0;
+  _MaxDepth = 0;
+  _IsMaxDepthTaken = false;
+  _Forwarded = 0;
+  memset(&_Snapshot, 0, sizeof(_Snapshot));
+}
+
+bool PacketRing::Push(const uint8_t *Data, size_t Length)
+{
+  // Producer side
+  uint32_t Head = _Head.load(std::memory_order_relaxed);
+  uint32_t Depth = Head - _Tail.load(std::memory_order_acquire);
+  if ( Length > PACKET_RING_PAYLOAD ) {
+    _Oversize.fetch_add(1, std::memory_order_relaxed); // Does not fit in a slot, never truncated
+    return false;
+  }
+  if ( Depth >= PACKET_RING_SIZE ) {
+    _Overflows.fetch_add(1, std::memory_order_relaxed); // Downstream is saturated: drop the newest
+    return false;
+  }
+  ring_packet_t *Packet = &_Packets[Head & (PACKET_RING_SIZE - 1)];
+  memcpy(Packet->Data, Data, Length);
+  Packet->Length = Length;
+  Packet->Timestamp = micros();
+  // Publish the packet only after its contents have been written
+  _Head.store(Head + 1, std::memory_order_release);
+  _Pushed.fetch_add(1, std::memory_order_relaxed);
+  if ( _IsMaxDepthTaken.load(std::memory_order_acquire) ) {
+    _MaxDepth.store(0, std::memory_order_relaxed); // Start a new period
+    _IsMaxDepthTaken.store(false, std::memory_order_release);
+  }
+  if ( (Depth + 1) > _MaxDepth.load(std::memory_order_relaxed) ) _MaxDepth.store(Depth + 1, std::memory_order_relaxed);
+  return true;
+}
+
+const ring_packet_t *PacketRing::Front(void)
+{
+  // Consumer side: the oldest packet or NULL when empty, valid until Pop()
+  uint32_t Tail = _Tail.load(std::memory_order_relaxed);
+  if ( Tail == _Head.load(std::memory_order_acquire) ) return NULL;
+  return &_Packets[Tail & (PACKET_RING_SIZE - 1)];
+}
+
+void PacketRing::Pop(void)
+{
+  // Consumer side: release the slot of the packet returned by Front()
+  uint32_t Tail = _Tail.load(std::memory_order_relaxed);
+  if ( Tail == _Head.load(std::memory_order_acquire) ) return;
+  _Tail.store(Tail + 1, std::memory_order_release);
+  _Forwarded++;
+}
+
+void PacketRing::TakeStats(ring_stats_t *Stats)
+{
+  // Consumer side: counts since the previous TakeStats(), producer counters are only read
+  uint32_t Pushed = _Pushed.load(std::memory_order_relaxed);
+  uint32_t Overflows = _Overflows.load(std::memory_order_relaxed);
+  uint32_t Oversize = _Oversize.load(std::memory_order_relaxed);
+  Stats->Pushed = Pushed - _Snapshot.Pushed;
+  Stats->Overflows = Overflows - _Snapshot.Overflows;
+  Stats->Oversize = Oversize - _Snapshot.Oversize;
+  Stats->Forwarded = _Forwarded - _Snapshot.Forwarded;
+  // The maximum cannot be subtracted: the producer restarts it on its next Push()
+  Stats->MaxDepth = _MaxDepth.load(std::memory_order_relaxed);
+  _IsMaxDepthTaken.store(true, std::memory_order_release);
+  _Snapshot.Pushed = Pushed;
+  _Snapshot.Overflows = Overflows;
+  _Snapshot.Oversize = Oversize;
+  _Snapshot.Forwarded = _Forwarded;
+}
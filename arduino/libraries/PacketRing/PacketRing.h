@@ -0,0 +1,60 @@
+/*
+ * PacketRing class: lock-free single producer, single consumer ring of fixed size packets
+ * The producer (a NimBLE client notify callback) pushes the received packets and never
+ * waits for the consumer (a forwarding task) that drains the ring to the server side.
+ * Only the producer writes _Head and only the consumer writes _Tail, no locks needed.
+ * When the ring is full the newest packet is dropped (overflow): the oldest slot can be in
+ * use by the consumer at that moment, the producer never touches it. The consumer drains
+ * the ring completely at every wake-up (samples are aggregated there), so an overflow
+ * means that the consumer has been starved.
+ * The statistics follow the same split: the counters only grow on their own side and the
+ * consumer reports the difference with its previous snapshot in TakeStats().
+ */
+#ifndef PacketRing_h
+#define PacketRing_h
+
+#include "Arduino.h"
+#include <atomic>
+
+#define PACKET_RING_SIZE     8   // Number of packets, must be a power of 2!
+#define PACKET_RING_PAYLOAD 244  // Max size of a packet in bytes: largest ATT MTU (247) minus 3 bytes ATT header
+
+typedef struct {
+  uint32_t Timestamp;  // micros() at Push(), for latency measurement
+  uint16_t Length;
+  uint8_t Data[PACKET_RING_PAYLOAD];
+} ring_packet_t;
+
+typedef struct {
+  uint32_t Pushed;
+  uint32_t Forwarded;
+  uint32_t Overflows;
+  uint32_t Oversize;   // Longer than PACKET_RING_PAYLOAD, dropped
+  uint32_t MaxDepth;
+} ring_stats_t;
+
+class PacketRing {
+
+  ring_packet_t _Packets[PACKET_RING_SIZE];
+  std::atomic<uint32_t> _Head;  // Next slot to write, producer only
+  std::atomic<uint32_t> _Tail;  // Next slot to read, consumer only
+  // Statistics, producer side: written by Push() only
+  std::atomic<uint32_t> _Pushed;
+  std::atomic<uint32_t> _Overflows;
+  std::atomic<uint32_t> _Oversize;
+  std::atomic<uint32_t> _MaxDepth;
+  std::atomic<bool> _IsMaxDepthTaken; // Set by the consumer, Push() restarts _MaxDepth
+  // Statistics, consumer side
+  uint32_t _Forwarded;
+  ring_stats_t _Snapshot;             // Counters at the previous TakeStats()
+
+public:
+
+  PacketRing();
+  bool Push(const uint8_t *Data, size_t Length);
+  const ring_packet_t *Front(void);
+  void Pop(void);
+  void TakeStats(ring_stats_t *Stats);
+};
+
+#endif
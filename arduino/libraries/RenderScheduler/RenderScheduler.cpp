@@ -0,0 +1,103 @@
+/*
+ * RenderScheduler class: merges display update requests and paces the rendering
+ * Version #1
+ *
+ */
+#include "RenderScheduler.h"
+
+RenderScheduler::RenderScheduler() {
+  // Default 10 FPS, no idle interval --> call Init() in setup to set the pace
+  _MinFrameInterval = 100;
+  _MinIdleInterval = 0;
+  _IsPending = false;
+  _LastFrameStart = 0;
+  _LastFrameEnd = 0;
+  _FrameStartMicros = 0;
+  _StatsStart = 0;
+  _Requests = 0;
+  _Frames = 0;
+  _RenderSum = 0;
+  _RenderMax = 0;
+}
+
+void RenderScheduler::Init(uint16_t MaxFps, uint16_t MinIdleMs)
+{
+  _MinFrameInterval = (MaxFps > 0) ? (1000 / MaxFps) : 0;
+  _MinIdleInterval = MinIdleMs;
+  _IsPending = false;
+  _LastFrameStart = millis() - _MinFrameInterval;
+  _LastFrameEnd = millis() - _MinIdleInterval;
+  ResetStats();
+}
+
+void RenderScheduler::RequestFrame(void)
+{
+  // Merge with a pending frame: only the latest state will be rendered
+  _Requests++;
+  _IsPending = true;
+}
+
+uint32_t RenderScheduler::TimeToNextFrame(uint32_t now)
+{
+  // Returns ms to wait for the next frame, 0 means render now!
+  if (!_IsPending) return RENDER_NOTHING_PENDING;
+  uint32_t sinceStart = now - _LastFrameStart;
+  uint32_t sinceEnd = now - _LastFrameEnd;
+  uint32_t waitStart = (sinceStart < _MinFrameInterval) ? (_MinFrameInterval - sinceStart) : 0;
+  uint32_t waitEnd = (sinceEnd < _MinIdleInterval) ? (_MinIdleInterval - sinceEnd) : 0;
+  return (waitStart > waitEnd) ? waitStart : waitEnd;
+}
+
+void RenderScheduler::BeginFrame(void)
+{
+  // Requests that arrive from now on are rendered in the next frame
+  _IsPending = false;
+  _LastFrameStart = millis();
+  _FrameStartMicros = micros();
+}
+
+void RenderScheduler::EndFrame(void)
+{
+  uint32_t renderTime = micros() - _FrameStartMicros;
+  _LastFrameEnd = millis();
+  _Frames++;
+  _RenderSum += renderTime;
+  if (renderTime > _RenderMax) _RenderMax = renderTime;
+}
+
+float RenderScheduler::GetAchievedFps(void)
+{
+  uint32_t period = millis() - _StatsStart;
+  return (period > 0) ? (_Frames * 1000.0 / period) : 0;
+}
+
+float RenderScheduler::GetAverageRenderMs(void)
+{
+  return (_Frames > 0) ? ((_RenderSum / 1000.0) / _Frames) : 0;
+}
+
+float RenderScheduler::GetMaxRenderMs(void)
+{
+  return (_RenderMax / 1000.0);
+}
+
+uint32_t RenderScheduler::GetRequests(void)
+{
+  return _Requests;
+}
+
+uint32_t RenderScheduler::GetDroppedFrames(void)
+{
+  // Every request that has not been rendered in a frame of its own was merged and dropped
+  uint32_t rendered = _Frames + (_IsPending ? 1 : 0);
+  return (_Requests > rendered) ? (_Requests - rendered) : 0;
+}
+
+void RenderScheduler::ResetStats(void)
+{
+  _StatsStart = millis();
+  _Requests = _IsPending ? 1 : 0;
+  _Frames = 0;
+  _RenderSum = 0;
+  _RenderMax = 0;
+}
@@ -0,0 +1,46 @@
+/*
+ * RenderScheduler class: frame-rate governor for the Oled and TFT display variants
+ * Display updates are requested (at any pace) by the BLE callbacks and merged into
+ * one pending frame, that is rendered not faster than MaxFps and not sooner than
+ * MinIdleMs after the previous frame has finished. Requests that are superseded by
+ * a newer request before being rendered are counted as dropped (stale) frames.
+ */
+#ifndef RenderScheduler_h
+#define RenderScheduler_h
+
+#include "Arduino.h"
+
+#define RENDER_NOTHING_PENDING 0xFFFFFFFF
+
+class RenderScheduler {
+
+  uint32_t _MinFrameInterval; // ms between the start of 2 frames --> 1000/MaxFps
+  uint32_t _MinIdleInterval;  // ms between the end of a frame and the start of the next
+  volatile bool _IsPending;
+  uint32_t _LastFrameStart;
+  uint32_t _LastFrameEnd;
+  uint32_t _FrameStartMicros;
+  // Statistics since the last ResetStats()
+  uint32_t _StatsStart;
+  volatile uint32_t _Requests;
+  uint32_t _Frames;
+  uint32_t _RenderSum;
+  uint32_t _RenderMax;
+
+public:
+
+  RenderScheduler();
+  void Init(uint16_t MaxFps, uint16_t MinIdleMs);
+  void RequestFrame(void);
+  uint32_t TimeToNextFrame(uint32_t now);
+  void BeginFrame(void);
+  void EndFrame(void);
+  float GetAchievedFps(void);
+  float GetAverageRenderMs(void);
+  float GetMaxRenderMs(void);
+  uint32_t GetRequests(void);
+  uint32_t GetDroppedFrames(void);
+  void ResetStats(void);
+};
+
+#endif